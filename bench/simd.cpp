@@ -0,0 +1,161 @@
+/***********************************************************************[simd.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "simd.hpp"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace SeqFROST;
+
+/*****************************************************/
+/*  Usage: micro-benchmark of the kernels in         */
+/*         'simd.hpp' against the scalar merges      */
+/*         they replaced, on random sorted clause    */
+/*         pairs; any mismatch fails the run         */
+/*  Build: 'make bench' in the source directory      */
+/*****************************************************/
+
+#define NPAIRS 200000
+#define NPASSES 20
+#define NVARS 1000
+
+struct PAIR { std::vector<uint32> a, b; uint32 x; };
+
+int scalarShared(const uint32* a, const int& na, const uint32* b, const int& nb)
+{
+	int i = 0, j = 0, shared = 0;
+	while (i < na && j < nb) {
+		const uint32 lit1 = a[i], lit2 = b[j];
+		if (lit1 < lit2) i++;
+		else if (lit2 < lit1) j++;
+		else shared++, i++, j++;
+	}
+	return shared;
+}
+
+bool scalarResolved(const uint32& x, const uint32* a, const int& na, const uint32* b, const int& nb, int& shared)
+{
+	int i = 0, j = 0;
+	shared = 0;
+	while (i < na && j < nb) {
+		const uint32 lit1 = a[i], lit2 = b[j];
+		const uint32 v1 = ABS(lit1), v2 = ABS(lit2);
+		if (v1 == x) i++;
+		else if (v2 == x) j++;
+		else if ((lit1 ^ lit2) == NEG_SIGN) return false;
+		else if (v1 < v2) i++;
+		else if (v2 < v1) j++;
+		else shared++, i++, j++;
+	}
+	return true;
+}
+
+// mostly short clauses with a long tail as seen in the simplifier
+int clauseSize(std::mt19937& gen)
+{
+	std::uniform_int_distribution<int> pick(0, 99);
+	const int p = pick(gen);
+	if (p < 85) return std::uniform_int_distribution<int>(2, 8)(gen);
+	return std::uniform_int_distribution<int>(9, 40)(gen);
+}
+
+// sorted clause over distinct variables including 'x' and
+// sharing some variables of 'with' (if given)
+void randClause(std::mt19937& gen, std::vector<uint32>& c, const uint32& x, const uint32& xlit, const std::vector<uint32>* with)
+{
+	std::vector<char> used(NVARS + 1, 0);
+	const int size = clauseSize(gen);
+	c.clear();
+	c.push_back(xlit), used[x] = 1;
+	std::uniform_int_distribution<uint32> var(1, NVARS), sign(0, 1), coin(0, 2);
+	if (with) {
+		for (uint32 lit : *with) {
+			if (int(c.size()) >= size) break;
+			const uint32 v = ABS(lit);
+			if (used[v] || coin(gen)) continue;
+			// sometimes complementary to make tautologies
+			c.push_back(coin(gen) ? lit : (sign(gen) ? lit : FLIP(lit)));
+			used[v] = 1;
+		}
+	}
+	while (int(c.size()) < size) {
+		const uint32 v = var(gen);
+		if (used[v]) continue;
+		c.push_back(V2L(v) | sign(gen));
+		used[v] = 1;
+	}
+	std::sort(c.begin(), c.end());
+}
+
+int main()
+{
+	std::mt19937 gen(2022);
+	std::uniform_int_distribution<uint32> var(1, NVARS);
+	std::vector<PAIR> pairs(NPAIRS);
+	for (PAIR& p : pairs) {
+		p.x = var(gen);
+		randClause(gen, p.a, p.x, V2L(p.x), NULL);
+		randClause(gen, p.b, p.x, NEG(V2L(p.x)), &p.a);
+	}
+#if defined(__AVX2__)
+	const char* isa = "AVX2";
+#elif defined(__SSE2__)
+	const char* isa = "SSE2";
+#else
+	const char* isa = "scalar";
+#endif
+	// scalar equivalence
+	uint64 mismatches = 0;
+	for (const PAIR& p : pairs) {
+		const int na = int(p.a.size()), nb = int(p.b.size());
+		if (countShared(p.a.data(), na, p.b.data(), nb) != scalarShared(p.a.data(), na, p.b.data(), nb)) mismatches++;
+		int vshared = 0, sshared = 0;
+		const bool vres = countResolved(p.x, p.a.data(), na, p.b.data(), nb, vshared);
+		const bool sres = scalarResolved(p.x, p.a.data(), na, p.b.data(), nb, sshared);
+		if (vres != sres || (vres && vshared != sshared)) mismatches++;
+	}
+	// timing
+	typedef std::chrono::steady_clock bench_clock;
+	uint64 checksum[2] = { 0, 0 };
+	double elapsed[2] = { 0, 0 };
+	for (int k = 0; k < 2; ++k) {
+		const bench_clock::time_point start = bench_clock::now();
+		for (int pass = 0; pass < NPASSES; ++pass) {
+			for (const PAIR& p : pairs) {
+				const int na = int(p.a.size()), nb = int(p.b.size());
+				int shared = 0;
+				if (k) {
+					checksum[k] += countShared(p.a.data(), na, p.b.data(), nb);
+					checksum[k] += countResolved(p.x, p.a.data(), na, p.b.data(), nb, shared) ? shared : 0;
+				}
+				else {
+					checksum[k] += scalarShared(p.a.data(), na, p.b.data(), nb);
+					checksum[k] += scalarResolved(p.x, p.a.data(), na, p.b.data(), nb, shared) ? shared : 0;
+				}
+			}
+		}
+		elapsed[k] = std::chrono::duration<double, std::milli>(bench_clock::now() - start).count();
+	}
+	printf(" %d clause pairs x %d passes\n", NPAIRS, NPASSES);
+	printf(" scalar kernels : %8.1f ms\n", elapsed[0]);
+	printf(" %-6s kernels : %8.1f ms\n", isa, elapsed[1]);
+	printf(" mismatches     : %lld\n", (long long)(mismatches + (checksum[0] != checksum[1])));
+	return mismatches || checksum[0] != checksum[1];
+}
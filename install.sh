@@ -26,6 +26,7 @@ $ch	-t or --assert        enable only code assertions
 $ch	-l or --logging       enable logging (needed for verbosity level > 2)
 $ch	-s or --statistics    enable costly statistics (may impact runtime)
 $ch	-a or --all           enable all above flags except 'debug', 'clean' and 'verbosity'
+$ch	-r or --profile       enable per-literal propagation profiling (see '--profileout')
 $ch	-p or --pedantic      compile with '-pedantic' flag
 $ch	-f or --fast          compile with '-use_fast_math' flag
 $ch	-w or --wall          compile with '-Wall' flag
@@ -59,6 +60,7 @@ logging=0
 pedantic=0
 standard=17
 statistics=0
+profile=0
 
 while [ $# -gt 0 ]
 do
@@ -79,6 +81,7 @@ do
 	-s|--statistics) statistics=1;;
 
 	-a|--all) all=1;;
+	-r|--profile) profile=1;;
 
     --standard=*)
       standard="${1#*=}"
@@ -252,6 +255,7 @@ if [[ "$HOST_OS" == *"cygwin"* ]]; then pedantic=0; fi
 [ $fast = 1 ] && CCFLAGS="$CCFLAGS -use_fast_math"
 [ $logging = 1 ] && CCFLAGS="$CCFLAGS -DLOGGING"
 [ $statistics = 1 ] && CCFLAGS="$CCFLAGS -DSTATISTICS"
+[ $profile = 1 ] && CCFLAGS="$CCFLAGS -DPROFILING"
 
 CCFLAGS="$ARCH $STD$CCFLAGS"
 
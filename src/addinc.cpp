@@ -39,6 +39,7 @@ uint32 Solver::iadd()
 	wt.expand(lit + 2);
 	ivalue.expand(lit + 2, UNDEF_VAL);
 	bumps.expand(v + 1, 0);
+	vtouched.expand(v + 1, 0);
 	chb.scores.expand(v + 1, 0);
 	vsids.scores.expand(v + 1, 0);
 	ilevel.expand(v + 1, UNDEF_LEVEL);
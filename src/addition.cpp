@@ -0,0 +1,269 @@
+/***********************************************************************[addition.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "simplify.hpp"
+#include "sort.hpp"
+
+using namespace SeqFROST;
+
+// clauses saved by replacing 'NCLS' clauses over 'NLITS' literals
+#define BVA_REDUCTION(NLITS, NCLS) (int64(NLITS) * int64(NCLS) - int64(NLITS) - int64(NCLS))
+
+uint32 Solver::freshVar()
+{
+	assert(!incremental);
+	inf.unassigned++;
+	const uint32 v = ++inf.maxVar;
+	const uint32 lit = V2L(v);
+	inf.nDualVars = lit + 2;
+	LOG2(3, "  adding fresh variable %d (%d unassigned)..", v, inf.unassigned);
+	// grow the search space with some slack; the
+	// surplus is trimmed once BVA is done
+	if (v >= sp->size()) {
+		SP* newSP = new SP(v + 1 + (v >> 4), opts.polarity);
+		newSP->copyAll(sp);
+		delete sp;
+		sp = newSP;
+	}
+	trail.reserve(v);
+	dlevel.reserve(v);
+	bumps.expand(v + 1, 0);
+	vtouched.expand(v + 1, 0);
+	chb.scores.expand(v + 1, 0);
+	chb.conflicts.expand(v + 1, 0);
+	vsids.scores.expand(v + 1, 0);
+	occurs.expand(v + 1), occurs[v] = { 0, 0 };
+	nogate.expand(v + 1, 0);
+	noblocked.expand(v + 1, 0);
+	ot.expand(inf.nDualVars);
+	touchVar(v);
+	// fresh variables are appended to the model
+	vorg.expand(v + 1), vorg[v] = model.lits.size();
+	model.lits.push(lit);
+	model.init(vorg);
+	if (opts.proof_en)
+		proof.init(sp, vorg);
+	vmtf.insert(v);
+	vmtf.update(v, (bumps[v] = ++bumped));
+	vsidsheap.insert(v);
+	chbheap.insert(v);
+	return v;
+}
+
+inline void Solver::matchBVA(const uint32& lit, const uint32& cls, const S_REF& cref, uVec1D& mlits, Vec<BVAMATCH>& matches, int64& ticks)
+{
+	SCLAUSE& c = scnf[cref];
+	LIT_ST* marks = sp->marks;
+	// mark 'c' and pick its least occurring literal other than 'lit'
+	uint32 lmin = 0;
+	int minsize = INT_MAX;
+	bool found = false;
+	forall_clause(c, k) {
+		const uint32 other = *k;
+		CHECKLIT(other);
+		marks[ABS(other)] = SIGN(other);
+		if (other == lit) found = true;
+		else if (ot[other].size() < minsize) {
+			minsize = ot[other].size();
+			lmin = other;
+		}
+	}
+	ticks -= c.size();
+	if (found && lmin) {
+		const int size = c.size();
+		OL& others = ot[lmin];
+		forall_occurs(others, i) {
+			const S_REF dref = *i;
+			if (dref == cref) continue;
+			SCLAUSE& d = scnf[dref];
+			if (!d.original() || d.size() != size) continue;
+			// 'd' can only have one literal hashed outside 'c'
+			const uint32 outside = d.sig() & ~c.sig();
+			if (outside & (outside - 1)) continue;
+			ticks -= size;
+			// 'd' must equal 'c' except for one literal in place of 'lit'
+			uint32 diff = 0;
+			int ndiffs = 0;
+			bool haslit = false;
+			forall_clause(d, k) {
+				const uint32 other = *k;
+				if (other == lit) { haslit = true; break; }
+				if (marks[ABS(other)] != SIGN(other)) {
+					if (++ndiffs > 1) break;
+					diff = other;
+				}
+			}
+			if (haslit || ndiffs != 1) continue;
+			bool fresh = true;
+			forall_vector(uint32, mlits, m) {
+				if (ABS(*m) == ABS(diff)) { fresh = false; break; }
+			}
+			if (fresh) matches.push({ dref, diff, cls });
+		}
+	}
+	forall_clause(c, k) {
+		marks[ABS(*k)] = UNDEF_VAL;
+	}
+}
+
+inline uint32 Solver::replaceBVA(const uint32& lit, uVec1D& mlits, Vec<S_REF>& mcls, Vec<S_REF>& matched, Lits_t& clause)
+{
+	const uint32 x = freshVar();
+	const uint32 px = V2L(x), nx = NEG(px);
+	// add all (x or m) before (-x or c\lit) with the fresh
+	// literal first as the RAT pivot of the proof
+	forall_vector(uint32, mlits, m) {
+		clause.clear();
+		clause.push(px), clause.push(*m);
+		if (opts.proof_en) proof.addClause(clause);
+		SORT(clause);
+		SCLAUSE* added = scnf.alloc(clause);
+		added->calcSig();
+		LOGCLAUSE(4, (*added), " BVA added");
+	}
+	forall_vector(S_REF, mcls, r) {
+		clause.clear();
+		clause.push(nx);
+		SCLAUSE& c = scnf[*r];
+		forall_clause(c, k) {
+			if (*k != lit) clause.push(*k);
+		}
+		if (opts.proof_en) proof.addClause(clause);
+		SORT(clause);
+		SCLAUSE* added = scnf.alloc(clause);
+		added->calcSig();
+		LOGCLAUSE(4, (*added), " BVA added");
+	}
+	// then remove the replaced clauses
+	uint32 removed = 0;
+	forall_vector(S_REF, mcls, r) {
+		SCLAUSE& c = scnf[*r];
+		if (c.deleted()) continue;
+		if (opts.proof_en) proof.deleteClause(c);
+		ot.touch(c);
+		c.markDeleted();
+		removed++;
+	}
+	forall_vector(S_REF, matched, r) {
+		SCLAUSE& d = scnf[*r];
+		if (d.deleted()) continue;
+		if (opts.proof_en) proof.deleteClause(d);
+		ot.touch(d);
+		d.markDeleted();
+		removed++;
+	}
+	LOG2(4, "  BVA replaced %d clauses by %d via variable %d", removed, mlits.size() + mcls.size(), x);
+#ifdef STATISTICS
+	stats.simplify.bva.variables++;
+	stats.simplify.bva.clauses += removed;
+#endif
+	indexOT();
+	syncOT();
+	return x;
+}
+
+void Solver::BVA()
+{
+	if (!opts.bva_en || incremental) return;
+	if (INTERRUPTED) killSolver();
+	LOG2(2, " Adding variables by bounded variable addition..");
+	updateOT();
+	if (opts.profile_simplifier) timer.pstart();
+	const int maxoccurs = opts.bva_max_occurs;
+	const int maxsize = opts.bva_clause_max;
+	int64 ticks = int64(opts.bva_effort) * 1000000;
+	// literals with more occurrences are tried first
+	uVec1D queue, scores(inf.nDualVars);
+	forall_literals(lit) {
+		const int size = ot[lit].size();
+		scores[lit] = size;
+		if (size > 2 && size <= maxoccurs) queue.push(lit);
+	}
+	QSORTCMP(queue, MCV_CMP(scores));
+	uVec1D mlits;
+	Vec<S_REF> mcls, tmpcls, matched, tmpmatched;
+	Vec<BVAMATCH> matches;
+	Lits_t clause;
+	for (uint32 q = 0; q < queue.size() && ticks > 0; ++q) {
+		const uint32 lit = queue[q];
+		CHECKLIT(lit);
+		OL& ol = ot[lit];
+		if (ol.size() > maxoccurs) continue;
+		mcls.clear();
+		forall_occurs(ol, i) {
+			const SCLAUSE& c = scnf[*i];
+			if (c.original() && c.size() > 1 && c.size() <= maxsize)
+				mcls.push(*i);
+		}
+		if (mcls.size() < 3) continue;
+		mlits.clear(), matched.clear();
+		mlits.push(lit);
+		// 'matched' holds per clause in 'mcls' the clauses
+		// of 'mlits' except 'lit' in row-major order
+		while (ticks > 0) {
+			matches.clear();
+			for (uint32 i = 0; i < mcls.size(); ++i)
+				matchBVA(lit, i, mcls[i], mlits, matches, ticks);
+			if (matches.empty()) break;
+			SORTCMP(matches, BVA_MATCH_CMP());
+			// pick the literal matching most clauses
+			uint32 best = 0, bestcount = 0;
+			for (uint32 i = 0; i < matches.size();) {
+				const uint32 cand = matches[i].lit;
+				uint32 count = 0, prevcls = UINT32_MAX;
+				for (; i < matches.size() && matches[i].lit == cand; ++i) {
+					if (matches[i].cls != prevcls) count++, prevcls = matches[i].cls;
+				}
+				if (count > bestcount) best = cand, bestcount = count;
+			}
+			const uint32 nlits = mlits.size();
+			if (BVA_REDUCTION(nlits + 1, bestcount) <= BVA_REDUCTION(nlits, mcls.size())) break;
+			// keep the clauses matched by 'best'
+			tmpcls.clear(), tmpmatched.clear();
+			uint32 prevcls = UINT32_MAX;
+			forall_vector(BVAMATCH, matches, m) {
+				if (m->lit != best || m->cls == prevcls) continue;
+				prevcls = m->cls;
+				tmpcls.push(mcls[prevcls]);
+				const S_REF* row = matched.data() + size_t(prevcls) * (nlits - 1);
+				for (uint32 j = 0; j < nlits - 1; ++j)
+					tmpmatched.push(row[j]);
+				tmpmatched.push(m->ref);
+			}
+			assert(tmpcls.size() == bestcount);
+			mcls.copyFrom(tmpcls), matched.copyFrom(tmpmatched);
+			mlits.push(best);
+		}
+		if (BVA_REDUCTION(mlits.size(), mcls.size()) <= 0) continue;
+		const uint32 x = replaceBVA(lit, mlits, mcls, matched, clause);
+		// revisit 'lit' and try the new definition
+		queue.push(lit);
+		queue.push(NEG(V2L(x)));
+	}
+	// trim the search space surplus
+	if (sp->size() > inf.maxVar + 1) {
+		SP* newSP = new SP(inf.maxVar + 1, opts.polarity);
+		newSP->copyAll(sp);
+		delete sp;
+		sp = newSP;
+		if (opts.proof_en)
+			proof.init(sp, vorg);
+	}
+	if (opts.profile_simplifier) timer.pstop(), timer.bva += timer.pcpuTime();
+	LOGREDALL(this, 2, "BVA Reductions");
+}
@@ -0,0 +1,103 @@
+/***********************************************************************[amo.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __AMO_
+#define __AMO_
+
+#include "simplify.hpp"
+#include "sort.hpp"
+
+using namespace SeqFROST;
+
+// neighbours in the at-most-one graph with more occurrences first
+struct AMO_CMP {
+	OT& ot;
+	AMO_CMP(OT& _ot) : ot(_ot) {}
+	inline bool operator () (const uint32& a, const uint32& b) const {
+		const uint32 x = ot[FLIP(a)].size(), y = ot[FLIP(b)].size();
+		if (x > y) return true;
+		if (x < y) return false;
+		return a < b;
+	}
+};
+
+// 'lit' and 'other' are never both true if '(-lit or -other)' is
+// an original binary in the occurrence list of '-lit'
+inline bool isAMOBinary(const SCLAUSE& c)
+{
+	return !c.deleted() && c.original() && c.size() == 2;
+}
+
+inline uint32 amoDegree(const uint32& lit, SCNF& scnf, OT& ot)
+{
+	CHECKLIT(lit);
+	uint32 degree = 0;
+	forall_occurs(ot[FLIP(lit)], i) {
+		if (isAMOBinary(scnf[*i])) degree++;
+	}
+	return degree;
+}
+
+// count once for every neighbour of the new clique member 'lit'
+inline void bumpAMO(const uint32& lit, SCNF& scnf, OT& ot, uVec1D& counts, uVec1D& stamps, uint32& stamp, uVec1D& touched, int64& ticks)
+{
+	CHECKLIT(lit);
+	const uint32 flit = FLIP(lit);
+	OL& list = ot[flit];
+	ticks -= list.size();
+	stamp++;
+	forall_occurs(list, i) {
+		const SCLAUSE& c = scnf[*i];
+		if (!isAMOBinary(c)) continue;
+		const uint32 other = FLIP(c[0] ^ c[1] ^ flit);
+		CHECKLIT(other);
+		if (stamps[other] == stamp) continue;
+		stamps[other] = stamp;
+		if (!counts[other]) touched.push(other);
+		counts[other]++;
+	}
+}
+
+// greedily grow a clique of pairwise-excluded literals around 'lit'
+inline void find_AMO(const uint32& lit, SCNF& scnf, OT& ot,
+					 uVec1D& counts, uVec1D& stamps, uint32& stamp,
+					 uVec1D& touched, uVec1D& cands, Lits_t& clique, int64& ticks)
+{
+	assert(touched.empty());
+	clique.clear();
+	clique.push(lit);
+	bumpAMO(lit, scnf, ot, counts, stamps, stamp, touched, ticks);
+	cands.clear();
+	forall_vector(uint32, touched, t) {
+		if (*t != lit) cands.push(*t);
+	}
+	QSORTCMP(cands, AMO_CMP(ot));
+	forall_vector(uint32, cands, c) {
+		const uint32 cand = *c;
+		if (counts[cand] < uint32(clique.size())) continue;
+		assert(counts[cand] == uint32(clique.size()));
+		clique.push(cand);
+		bumpAMO(cand, scnf, ot, counts, stamps, stamp, touched, ticks);
+	}
+	forall_vector(uint32, touched, t) {
+		counts[*t] = 0;
+	}
+	touched.clear();
+}
+
+#endif
@@ -48,7 +48,7 @@ inline void	Solver::bumpReasons(const uint32& lit)
 	const uint32 v = ABS(lit);
 	const C_REF r = sp->source[v];
 	if (REASON(r)) {
-		CLAUSE& c = cm[r];
+		CLAUSE& c = explain(r, lit);
 		if (c.binary()) {
 			const uint32 other = c[0] ^ c[1] ^ lit;
 			bumpReason(other);
@@ -191,7 +191,9 @@ void Solver::analyze()
 		if (UNSAT) return;
 		if (!LEVEL) { learnEmpty(); return; }
 		// find first-UIP
+		ANALYSIS_START(uiptime);
 		conflictchanged = finduip();
+		ANALYSIS_STOP(finduip, uiptime);
 	}
 
 	// check overflow
@@ -209,21 +211,33 @@ void Solver::analyze()
 		// minimize learnt clause 
 #ifdef STATISTICS
 		stats.minimize.before += learntC.size();
+		stats.analysis.before.add(learntC.size());
 #endif
 
 		if (opts.minimizesort_en)
 			QSORTCMP(learntC, MINIMIZE_CMP(sp));
-		if (opts.minimize_en && learntC.size() > 1)
+		if (opts.minimize_en && learntC.size() > 1) {
+			ANALYSIS_START(mintime);
 			minimize();
-		if (opts.minimizeall_en && learntC.size() > 1)
+			ANALYSIS_STOP(minimize, mintime);
+		}
+		if (opts.minimizeall_en && learntC.size() > 1) {
+			ANALYSIS_START(minalltime);
 			minimizeall();
+			ANALYSIS_STOP(minimizeall, minalltime);
+		}
 		if (opts.minimizebin_en && learntC.size() > 1
 			&& sp->learntLBD <= opts.minimize_lbd
-			&& learntC.size() <= opts.minimize_min)
+			&& learntC.size() <= opts.minimize_min) {
+			ANALYSIS_START(minbintime);
 			minimizebin();
+			ANALYSIS_STOP(minimizebin, minbintime);
+		}
 
 #ifdef STATISTICS
 		stats.minimize.after += learntC.size();
+		stats.analysis.after.add(learntC.size());
+		stats.analysis.lbd.add(sp->learntLBD);
 #endif
 
 		// update lbd restart mechanism
@@ -240,7 +254,12 @@ void Solver::analyze()
 		assert(learntC.size() == 1);
 
 	// learn control
+	ANALYSIS_START(learntime);
 	C_REF added = learn();
+#ifdef STATISTICS
+	// exclude backtracking measured inside 'learn'
+	stats.analysis.learn.add(nanotime() - learntime - stats.analysis.backtracking);
+#endif
 
 	// clear 
 	conflict = UNDEF_REF;
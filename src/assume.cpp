@@ -158,7 +158,7 @@ void Solver::ianalyze(const uint32& failed)
 		if (sp->seen[parentv]) {
 			const C_REF r = sp->source[parentv];
 			if (REASON(r)) {
-				CLAUSE& c = cm[r];
+				CLAUSE& c = explain(r, parent);
 				LOGCLAUSE(4, c, "  analyzing %d reason", l2i(parent));
 				forall_clause(c, k) {
 					const uint32 other = *k;
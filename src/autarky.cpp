@@ -47,10 +47,11 @@ uint32 Solver::autarkReasoning(LIT_ST* autarkies)
 	assert(analyzed.empty());
 	const LIT_ST* values = sp->value;
 	const State_t* states = sp->state;
-	// assign all variables with saved phases
+	// assign all variables with saved phases except
+	// those in at-most-one constraints not seen here
 	uint32 assigned = 0;
 	forall_variables(v) {
-		if (states[v].state) continue;
+		if (states[v].state || cards.contains(v)) continue;
 		assert(sp->phase[v].saved >= 0);
 		const uint32 dec = V2DEC(v, sp->phase[v].saved);
 		autarkies[dec] = 1;
@@ -166,6 +167,7 @@ void Solver::autarky()
 	attachNonBins(orgs, cs, deleted, true);
 	attachNonBins(learnts, cs, deleted, true);
 	if (retrail()) LOG2(2, " Propagation after autarky proved a contradiction");
+	else if (eliminated) buildGauss();
 	UPDATE_SLEEPER(autarky, eliminated);
 	printStats(eliminated, 'k', CCYAN);
 }
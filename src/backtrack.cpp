@@ -68,6 +68,20 @@ void Solver::backtrack(const uint32& jmplevel)
 	const uint32* levels = sp->level;
 	
 	uint32* start = trail, *i = start + from, *j = i, *end = trail.end();
+
+	// save the cancelled segment (in trail order) with its reasons
+	// to be restored later by 'restoreTrail' without watch scanning
+	clearSavedTrail();
+	if (opts.trailsave_en && !probed) {
+		const C_REF* sources = sp->source;
+		for (const uint32* k = i; k != end; ++k) {
+			const uint32 lit = *k, v = ABS(lit);
+			if (levels[v] > jmplevel) 
+				savedtrail.push(SAVED(lit, sources[v]));
+		}
+		stats.trailsave.saved += savedtrail.size();
+	}
+
 	if (stable) {
 		dheap_t& heap = DECISIONHEAP;  
 		while (i != end) {
@@ -101,6 +115,8 @@ void Solver::backtrack(const uint32& jmplevel)
 	LOG2(3, "  %d literals kept (%d are saved) and %zd are cancelled", remained, remained - from, end - j);
 	trail.resize(remained);
 	if (sp->propagated > from) sp->propagated = from;
+	if (gauss.propagated > from) gauss.propagated = from;
+	if (gauss.reasons.size()) removeGaussReasons();
 	dlevel.resize(pivot);
 	decisionlevel = jmplevel;
 	assert(LEVEL == (dlevel.size() - 1));
@@ -25,7 +25,7 @@ inline uint32 Solver::analyzeReason(const C_REF& ref, const uint32& lit)
 	assert(REASON(ref));
 	const uint32* levels = sp->level;
 	const uint32 fit = FLIP(lit);
-	CLAUSE& reason = cm[ref];
+	CLAUSE& reason = explain(ref, fit);
 	LOGCLAUSE(4, reason, "   checking %d reason", l2i(fit));
 	uint32 dom = 0;
 	forall_clause(reason, k) {
@@ -41,7 +41,8 @@ inline uint32 Solver::analyzeReason(const C_REF& ref, const uint32& lit)
 
 uint32 Solver::hyper2Resolve(uint32* lits, const int csize, const uint32& lit)
 {
-	assert(LEVEL == 1);
+	// reasons lead from every assigned literal to the last decision
+	assert(LEVEL);
 
 	const uint32* levels = sp->level;
 
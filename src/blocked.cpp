@@ -20,37 +20,81 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace SeqFROST;
 
+// key of the witness cached for 'ref' being blocked on 'lit'
+inline uint64 witnessKey(const S_REF& ref, const uint32& lit)
+{
+	const uint64 key = (uint64(ref) * HASH_MUL) ^ hashLit(lit);
+	return key == HASH_EMPTY ? 1 : key;
+}
+
 void Solver::BCE()
 {
 	if (opts.bce_en) {
 		if (INTERRUPTED) killSolver();
 		LOG2(2, " Eliminating blocked clauses..");
 		if (opts.profile_simplifier) timer.pstart();
+		SET_BOUNDS(limit, bce, simplify.ticks.bce, searchticks, inf.nLiterals);
+		uint64& ticks = stats.simplify.ticks.bce;
 		forall_vector(uint32, elected, i) {
 			const uint32 v = *i;
 			if (!v) continue;
+			// a variable is either fully checked or left as is
+			if (ticks > limit) {
+				LOG2(2, "  BCE budget exhausted");
+				break;
+			}
+			// nothing became blocked unless its lists changed
+			if (noblocked[v]) {
+			#ifdef STATISTICS
+				stats.simplify.bce.skipped++;
+			#endif
+				continue;
+			}
 			const uint32 p = V2L(v), n = NEG(p);
 			OL& poss = ot[p], &negs = ot[n];
 			if (poss.size() <= opts.bce_max_occurs && negs.size() <= opts.bce_max_occurs) {
 				// start with negs
 				forall_occurs(negs, i) {
-					SCLAUSE& neg = scnf[*i];
+					const S_REF nref = *i;
+					SCLAUSE& neg = scnf[nref];
+					ticks++;
 					if (neg.original()) {
+						// the last witness is likely to still be one
+						const uint64 key = witnessKey(nref, n);
+						const S_REF wref = witnesses.find(key, [](const C_REF&) { return true; });
+						if (wref != UNDEF_REF) {
+							SCLAUSE& pos = scnf[wref];
+							ticks++;
+							if (pos.original() && pos.has(p) && !isTautology(v, neg, pos)) {
+							#ifdef STATISTICS
+								stats.simplify.bce.cached++;
+							#endif
+								continue;
+							}
+						}
 						bool allTautology = true;
 						forall_occurs(poss, j) {
 							SCLAUSE& pos = scnf[*j];
+							ticks++;
 							if (pos.original() && !isTautology(v, neg, pos)) {
+								// first candidates are found again by the scan
+								if (j != poss) witnesses.assign(key, *j);
 								allTautology = false;
 								break;
 							}
 						}
 						if (allTautology) {
 							assert(neg.original());
+						#ifdef STATISTICS
+							stats.simplify.bce.blocked++;
+						#endif
 							model.saveClause(neg, neg.size(), n);
+							ot.touch(neg);
 							neg.markDeleted();
 						}
 					}
 				}
+				noblocked[v] = 1;
 			}
 		}
 		if (opts.profile_simplifier) timer.pstop(), timer.bce += timer.pcpuTime();
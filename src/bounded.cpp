@@ -15,183 +15,243 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with this program.  If not, see <https://www.gnu.org/licenses/>.
 **********************************************************************************/
-
 #include "and.hpp"
 #include "xor.hpp"
+#include "threads.hpp"
 #include "equivalence.hpp"
 #include "ifthenelse.hpp"
 #include "function.hpp"
 
 using namespace SeqFROST;
 
+// elected variables handed to a thread at once
+constexpr uint32 VE_CHUNK = 64;
+
+// lists scanned and resolvent pairs checked when planning 'v'
+inline uint64 veTicks(OT& ot, const uint32& v)
+{
+	const uint64 ps = ot[V2L(v)].size(), ns = ot[NEG(V2L(v))].size();
+	return 1 + ps + ns + ps * ns;
+}
+
 void Solver::VE()
 {
 	if (!opts.ve_en) return;
 	LOG2(2, " Eliminating variables..");
 	if (INTERRUPTED) killSolver();
 	if (opts.profile_simplifier) timer.pstart();
-	Lits_t out_c;
-	out_c.reserve(opts.ve_clause_max);
 
-#ifdef STATISTICS
-	BVESTATS& bvestats = stats.simplify.bve;
-#endif
+	// spend the budget in the election order before planning, so
+	// variables left to later phases are the same for any threads
+	SET_BOUNDS(limit, ve, simplify.ticks.ve, searchticks, inf.nLiterals);
+	uint32 nelected = 0;
+	while (nelected < elected.size() && stats.simplify.ticks.ve <= limit) {
+		const uint32 v = elected[nelected++];
+		stats.simplify.ticks.ve += nogate[v] ? 1 : veTicks(ot, v);
+	}
+	if (nelected < elected.size())
+		LOG2(2, "  VE budget exhausted after %d of %d elected variables", nelected, elected.size());
 
-	const bool firstcall = stats.simplify.calls == 1;
-	forall_vector(uint32, elected, i) {
-		uint32 v = *i;
-		CHECKVAR(v);
-		assert(!sp->state[v].state);
-		const uint32 p = V2L(v), n = NEG(p);
-		OL& poss = ot[p], &negs = ot[n];
-		assert(isSorted(poss.data(), poss.size(), CNF_CMP_KEY(scnf)));
-		assert(isSorted(negs.data(), negs.size(), CNF_CMP_KEY(scnf)));
-		int pOrgs = 0, nOrgs = 0;
-		int nAddedCls = 0, nAddedLits = 0;
-		if (firstcall) {
-			pOrgs = poss.size();
-			nOrgs = negs.size();
+	// LCVE guarantees that elected variables share no clauses, 
+	// thus eliminations can be planned independently in parallel
+	// and then applied in the election order to keep 'model', 
+	// proof and 'scnf' identical regardless of the threads count
+	const uint32 nthreads = nThreads(opts.simp_threads, nelected, VE_CHUNK);
+	Vec<VEWORKER> workers(nthreads);
+	Vec<VEPLAN> plans(nelected);
+	CHUNKS chunks(nelected, VE_CHUNK);
+	runThreads(nthreads, [&](const uint32 tid) {
+		VEWORKER& worker = workers[tid];
+		worker.out_c.reserve(opts.ve_clause_max);
+		uint32 begin, end;
+		while (chunks.pop(begin, end)) {
+			for (uint32 i = begin; i < end; ++i) {
+				// failed before and its lists are unchanged since
+				if (nogate[elected[i]]) continue;
+				planVE(elected[i], tid, worker, plans[i]);
+			}
 		}
-		else {
-			assert(stats.simplify.calls > 1);
-			countOrgs(scnf, poss, pOrgs);
-			countOrgs(scnf, negs, nOrgs);
+	});
+
+	for (uint32 i = 0; i < nelected; ++i) {
+		const VEPLAN& plan = plans[i];
+		if (plan.type) {
+			applyVE(elected[i], plan, workers[plan.worker]);
+			markEliminated(elected[i]);
+			elected[i] = 0;
 		}
-		// pure-literal
-		if (!pOrgs || !nOrgs) {
-			toblivion(p, poss, n, negs, pOrgs, nOrgs, scnf, model);
+		else if (nogate[elected[i]]) {
 #ifdef STATISTICS
-			bvestats.pures++;
+			stats.simplify.bve.skipped++;
 #endif
-			v = 0;
 		}
-		// Equiv/NOT-gate Reasoning
-		else if (uint32 def = find_BN_gate(p, n, scnf, poss, negs)) {
-#ifdef STATISTICS
-			bvestats.inverters++;
-#endif
-			save_BN_gate(p, pOrgs, nOrgs, scnf, poss, negs, model);
-			if (substitute_single(p, n, def, scnf, poss, negs)) {
-				LOG2(2, "  BVE proved a contradiction");
-				learnEmpty();
-				killSolver();
-			}
-			v = 0;
-		}
-		// simple resolution case 
-		else if ((pOrgs == 1 || nOrgs == 1) && countResolvents(v, scnf, poss, negs, nAddedCls, nAddedLits)) {
-			if (nAddedCls) resolve(v, out_c, nAddedCls, nAddedLits);
-			toblivion(p, poss, n, negs, pOrgs, nOrgs, scnf, model);
+		else nogate[elected[i]] = 1;
+	}
+
 #ifdef STATISTICS
-			bvestats.resolutions++;
+	BVESTATS& bvestats = stats.simplify.bve;
+	for (uint32 t = 0; t < nthreads; ++t) {
+		const BVESTATS& local = workers[t].stats;
+		bvestats.pures += local.pures;
+		bvestats.resolutions += local.resolutions;
+		bvestats.inverters += local.inverters;
+		bvestats.andors += local.andors;
+		bvestats.ites += local.ites;
+		bvestats.xors += local.xors;
+		bvestats.funs += local.funs;
+	}
 #endif
-			v = 0;
-		}
-		else {
-			assert(pOrgs && nOrgs);
-			nAddedCls = 0;
-			nAddedLits = 0;
-			out_c.clear();
-			const int orgCls = pOrgs + nOrgs;
-			Byte type = 0;
-			if (orgCls > 2) {
-				// AND/OR-gate Reasoning
-				if (find_AO_gate(n, negs, p, poss, scnf, out_c, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.andors++;
-					#endif
-				}
-				else if (!nAddedCls && find_AO_gate(p, poss, n, negs, scnf, out_c, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.andors++;
-					#endif
-				}
-			}
-			if (!type && orgCls > 3) {
-				// ITE-gate Reasoning
-				if (find_ITE_gate(p, poss, n, negs, scnf, ot, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.ites++;
-					#endif
-				}
-				else if (!nAddedCls && find_ITE_gate(n, negs, p, poss, scnf, ot, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.ites++;
-					#endif
-				}
-				// XOR-gate Reasoning
-				else if (find_XOR_gate(p, poss, n, negs, scnf, ot, out_c, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.xors++;
-					#endif
-				}
-				else if (!nAddedCls && find_XOR_gate(n, negs, p, poss, scnf, ot, out_c, orgCls, nAddedCls, nAddedLits)) {
-					type = SUBSTITUTION;
-					#ifdef STATISTICS
-					bvestats.xors++;
-					#endif
-				}
+
+	if (opts.profile_simplifier) timer.pstop(), timer.ve += timer.pcpuTime();
+	LOGREDALL(this, 2, "VE Reductions");
+}
+
+// runs concurrently: touches only the clauses of 'v' and 'worker'
+void Solver::planVE(const uint32& v, const uint32& tid, VEWORKER& worker, VEPLAN& plan)
+{
+	CHECKVAR(v);
+	assert(!sp->state[v].state);
+	BVESTATS& bvestats = worker.stats;
+	Lits_t& out_c = worker.out_c;
+	const uint32 p = V2L(v), n = NEG(p);
+	OL& poss = ot[p], &negs = ot[n];
+	assert(isSorted(poss.data(), poss.size(), CNF_CMP_KEY(scnf)));
+	assert(isSorted(negs.data(), negs.size(), CNF_CMP_KEY(scnf)));
+	int pOrgs = 0, nOrgs = 0;
+	int nAddedCls = 0, nAddedLits = 0;
+	if (stats.simplify.calls == 1) {
+		pOrgs = poss.size();
+		nOrgs = negs.size();
+	}
+	else {
+		assert(stats.simplify.calls > 1);
+		countOrgs(scnf, poss, pOrgs);
+		countOrgs(scnf, negs, nOrgs);
+	}
+	Byte type = 0;
+	// pure-literal
+	if (!pOrgs || !nOrgs) {
+		type = PURELITERAL;
+		bvestats.pures++;
+	}
+	// Equiv/NOT-gate Reasoning
+	else if (uint32 def = find_BN_gate(p, n, scnf, poss, negs)) {
+		type = BUFFERGATE;
+		plan.def = def;
+		bvestats.inverters++;
+	}
+	// simple resolution case 
+	else if ((pOrgs == 1 || nOrgs == 1) && countResolvents(v, scnf, poss, negs, nAddedCls, nAddedLits)) {
+		type = RESOLUTION;
+		bvestats.resolutions++;
+	}
+	else {
+		assert(pOrgs && nOrgs);
+		nAddedCls = 0;
+		nAddedLits = 0;
+		out_c.clear();
+		const int orgCls = pOrgs + nOrgs;
+		if (orgCls > 2) {
+			// AND/OR-gate Reasoning
+			if (find_AO_gate(n, negs, p, poss, scnf, out_c, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.andors++;
 			}
-			// fun-gate reasoning
-			if (!type && orgCls > 2 && find_fun_gate(p, orgCls, scnf, ot, nAddedCls, nAddedLits)) {
-				if (UNSAT) {
-					LOG2(2, "  BVE proved a contradiction during fun search");
-					if (opts.proof_en) proof.addEmpty();
-					killSolver();
-				}
-				type = CORESUBSTITUTION;
-				#ifdef STATISTICS
-				bvestats.funs++;
-				#endif
+			else if (!nAddedCls && find_AO_gate(p, poss, n, negs, scnf, out_c, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.andors++;
 			}
-			// n-by-m resolution
-			else if (!type && !nAddedCls && countResolvents(v, orgCls, scnf, poss, negs, nAddedCls, nAddedLits)) {
-				type = RESOLUTION;
-				#ifdef STATISTICS
-				bvestats.resolutions++;
-				#endif
+		}
+		if (!type && orgCls > 3) {
+			// ITE-gate Reasoning
+			if (find_ITE_gate(p, poss, n, negs, scnf, ot, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.ites++;
 			}
-			//=======================
-			// resolve or substitute
-			//=======================
-			if (type & SUBSTITUTION) {
-				if (nAddedCls) substitute(v, out_c, nAddedCls, nAddedLits);
-				toblivion(p, poss, n, negs, pOrgs, nOrgs, scnf, model);
-				v = 0;
+			else if (!nAddedCls && find_ITE_gate(n, negs, p, poss, scnf, ot, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.ites++;
 			}
-			else if (type & CORESUBSTITUTION) {
-				if (nAddedCls) resolveCore(v, out_c, nAddedCls, nAddedLits);
-				toblivion(p, poss, n, negs, pOrgs, nOrgs, scnf, model);
-				v = 0;
+			// XOR-gate Reasoning
+			else if (find_XOR_gate(p, poss, n, negs, scnf, ot, out_c, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.xors++;
 			}
-			else if (type & RESOLUTION) {
-				if (nAddedCls) resolve(v, out_c, nAddedCls, nAddedLits);
-				toblivion(p, poss, n, negs, pOrgs, nOrgs, scnf, model);
-				v = 0;
+			else if (!nAddedCls && find_XOR_gate(n, negs, p, poss, scnf, ot, out_c, orgCls, nAddedCls, nAddedLits)) {
+				type = SUBSTITUTION;
+				bvestats.xors++;
 			}
 		}
-		if (!v) {
-			markEliminated(*i);
-			*i = 0;
+		// fun-gate reasoning
+		bool contradiction = false;
+		if (!type && orgCls > 2 && find_fun_gate(p, orgCls, scnf, ot, nAddedCls, nAddedLits, contradiction)) {
+			type = contradiction ? CONTRADICTION : CORESUBSTITUTION;
+			bvestats.funs++;
+		}
+		// n-by-m resolution
+		else if (!type && !nAddedCls && countResolvents(v, orgCls, scnf, poss, negs, nAddedCls, nAddedLits)) {
+			type = RESOLUTION;
+			bvestats.resolutions++;
 		}
 	}
-	if (opts.profile_simplifier) timer.pstop(), timer.ve += timer.pcpuTime();
-	LOGREDALL(this, 2, "VE Reductions");
+	plan.type = type;
+	plan.worker = tid;
+	plan.pOrgs = pOrgs, plan.nOrgs = nOrgs;
+	plan.nAddedCls = nAddedCls, plan.nAddedLits = nAddedLits;
+	plan.first = worker.resolvents.size();
+	//=======================
+	// resolve or substitute
+	//=======================
+	if (nAddedCls) {
+		if (type & SUBSTITUTION) substitute(v, worker, nAddedCls);
+		else if (type & CORESUBSTITUTION) resolveCore(v, worker, nAddedCls);
+		else if (type & RESOLUTION) resolve(v, worker, nAddedCls);
+	}
 }
 
-inline void Solver::substitute(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits)
+void Solver::applyVE(const uint32& v, const VEPLAN& plan, VEWORKER& worker)
+{
+	CHECKVAR(v);
+	const uint32 p = V2L(v), n = NEG(p);
+	OL& poss = ot[p], &negs = ot[n];
+	if (plan.type & CONTRADICTION) {
+		LOG2(2, "  BVE proved a contradiction during fun search");
+		SET_UNSAT;
+		if (opts.proof_en) proof.addEmpty();
+		killSolver();
+	}
+	if (plan.type & BUFFERGATE) {
+		save_BN_gate(p, plan.pOrgs, plan.nOrgs, scnf, poss, negs, model);
+		if (substitute_single(p, n, plan.def, scnf, ot)) {
+			LOG2(2, "  BVE proved a contradiction");
+			learnEmpty();
+			killSolver();
+		}
+		return;
+	}
+	if (plan.nAddedCls && (plan.type & (RESOLUTION | SUBSTITUTION | CORESUBSTITUTION))) 
+		addResolvents(plan, worker);
+	toblivion(p, n, plan.pOrgs, plan.nOrgs, scnf, ot, model);
+}
+
+inline void Solver::saveResolvent(VEWORKER& worker)
+{
+	const Lits_t& out_c = worker.out_c;
+	uVec1D& resolvents = worker.resolvents;
+	const int size = out_c.size();
+	assert(size);
+	resolvents.push(size);
+	for (int k = 0; k < size; ++k)
+		resolvents.push(out_c[k]);
+}
+
+inline void Solver::substitute(const uint32& x, VEWORKER& worker, const int& nAddedCls)
 {
 	CHECKVAR(x);
 	LOG2(4, " Substituting(%d):", x);
 	LOGOCCURS(this, 4, x);
+	Lits_t& out_c = worker.out_c;
 	int checksum = 0;
-	S_REF ref;
-	S_REF* refs = scnf.alloc(ref, nAddedCls, nAddedLits);
 	uint32 dx = V2L(x), fx = NEG(dx);
 
 	if (ot[dx].size() > ot[fx].size()) std::swap(dx, fx);
@@ -206,8 +266,8 @@ inline void Solver::substitute(const uint32& x, Lits_t& out_c, const int& nAdded
 				if (cj.original()) {
 					const bool b = cj.molten();
 					if (NEQUAL(a, b) && merge(x, ci, cj, out_c)) {
-						addResolvent(out_c, ref);		
-						refs[checksum++] = ref, ref += SCBUCKETS(out_c.size());
+						saveResolvent(worker);
+						checksum++;
 					}						
 				}
 			}
@@ -216,14 +276,13 @@ inline void Solver::substitute(const uint32& x, Lits_t& out_c, const int& nAdded
 	assert(checksum == nAddedCls);
 }
 
-inline void Solver::resolveCore(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits)
+inline void Solver::resolveCore(const uint32& x, VEWORKER& worker, const int& nAddedCls)
 {
 	CHECKVAR(x);
 	LOG2(4, " Resolving(%d) using core:", x);
 	LOGOCCURS(this, 4, x);
+	Lits_t& out_c = worker.out_c;
 	int checksum = 0;
-	S_REF ref;
-	S_REF* refs = scnf.alloc(ref, nAddedCls, nAddedLits);
 	uint32 dx = V2L(x), fx = NEG(dx);
 
 	if (ot[dx].size() > ot[fx].size()) std::swap(dx, fx);
@@ -238,8 +297,8 @@ inline void Solver::resolveCore(const uint32& x, Lits_t& out_c, const int& nAdde
 				if (cj.original()) {
 					const bool b = cj.molten();
 					if ((!a || !b) && merge(x, ci, cj, out_c)) {
-						addResolvent(out_c, ref);		
-						refs[checksum++] = ref, ref += SCBUCKETS(out_c.size());
+						saveResolvent(worker);
+						checksum++;
 					}
 				}
 			}
@@ -248,14 +307,13 @@ inline void Solver::resolveCore(const uint32& x, Lits_t& out_c, const int& nAdde
 	assert(checksum == nAddedCls);
 }
 
-inline void Solver::resolve(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits)
+inline void Solver::resolve(const uint32& x, VEWORKER& worker, const int& nAddedCls)
 {
 	CHECKVAR(x);
 	LOG2(4, " Resolving(%d):", x);
 	LOGOCCURS(this, 4, x);
+	Lits_t& out_c = worker.out_c;
 	int checksum = 0;
-	S_REF ref;
-	S_REF* refs = scnf.alloc(ref, nAddedCls, nAddedLits);
 	uint32 dx = V2L(x), fx = NEG(dx);
 
 	if (ot[dx].size() > ot[fx].size()) std::swap(dx, fx);
@@ -267,8 +325,8 @@ inline void Solver::resolve(const uint32& x, Lits_t& out_c, const int& nAddedCls
 			forall_occurs(other, j) {
 				SCLAUSE& cj = scnf[*j];
 				if (cj.original() && merge(x, ci, cj, out_c)) {
-					addResolvent(out_c, ref);		
-					refs[checksum++] = ref, ref += SCBUCKETS(out_c.size());
+					saveResolvent(worker);
+					checksum++;
 				}
 			}
 		}
@@ -276,12 +334,25 @@ inline void Solver::resolve(const uint32& x, Lits_t& out_c, const int& nAddedCls
 	assert(checksum == nAddedCls);
 }
 
-inline void Solver::addResolvent(const Lits_t& resolvent, const S_REF& ref)
+inline void Solver::addResolvents(const VEPLAN& plan, VEWORKER& worker)
+{
+	int checksum = 0;
+	S_REF ref;
+	S_REF* refs = scnf.alloc(ref, plan.nAddedCls, plan.nAddedLits);
+	const uint32* resolvent = worker.resolvents + plan.first;
+	while (checksum < plan.nAddedCls) {
+		const int size = *resolvent++;
+		addResolvent(resolvent, size, ref);
+		refs[checksum++] = ref, ref += SCBUCKETS(size);
+		resolvent += size;
+	}
+}
+
+inline void Solver::addResolvent(const uint32* resolvent, const int& size, const S_REF& ref)
 {
-	const int size = resolvent.size();
 	assert(size);
 	if (size == 1) {
-		const uint32 unit = resolvent[0];
+		const uint32 unit = *resolvent;
 		CHECKLIT(unit);
 		const LIT_ST val = sp->value[unit];
 		if (UNASSIGNED(val)) {
@@ -294,7 +365,7 @@ inline void Solver::addResolvent(const Lits_t& resolvent, const S_REF& ref)
 		}
 	}
 	else {
-		SCLAUSE* added = new (scnf.clause(ref)) SCLAUSE(resolvent);
+		SCLAUSE* added = new (scnf.clause(ref)) SCLAUSE(resolvent, size);
 		assert(added->size() == size);
 		assert(added->hasZero() < 0);
 		assert(added->original());
@@ -305,4 +376,4 @@ inline void Solver::addResolvent(const Lits_t& resolvent, const S_REF& ref)
 		added->markAdded();
 		LOGCLAUSE(4, (*added), " Resolvent");
 	}
-}
\ No newline at end of file
+}
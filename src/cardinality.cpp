@@ -0,0 +1,203 @@
+/***********************************************************************[cardinality.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "amo.hpp"
+
+using namespace SeqFROST;
+
+// replace cliques of original binaries '(-x or -y)' by native
+// at-most-one constraints that are propagated during search
+void Solver::AMO()
+{
+	if (!opts.amo_en || opts.proof_en || incremental) return;
+	if (INTERRUPTED) killSolver();
+	LOG2(2, " Extracting at-most-one constraints..");
+	updateOT();
+	if (opts.profile_simplifier) timer.pstart();
+	stats.amo.calls++;
+	const int minsize = opts.amo_min_size;
+	int64 ticks = int64(opts.amo_effort) * 1000000;
+	// literals excluding more literals are tried first
+	uVec1D queue, scores(inf.nDualVars);
+	forall_literals(lit) {
+		const uint32 degree = amoDegree(lit, scnf, ot);
+		scores[lit] = degree;
+		if (int(degree) >= minsize - 1) queue.push(lit);
+	}
+	QSORTCMP(queue, MCV_CMP(scores));
+	uVec1D counts(inf.nDualVars, 0), stamps(inf.nDualVars, 0);
+	uVec1D touched, cands;
+	Lits_t clique;
+	uint32 stamp = 0, found = 0;
+	LIT_ST* marks = sp->marks;
+	for (uint32 q = 0; q < queue.size() && ticks > 0; ++q) {
+		const uint32 lit = queue[q];
+		CHECKLIT(lit);
+		if (int(amoDegree(lit, scnf, ot)) < minsize - 1) continue;
+		find_AMO(lit, scnf, ot, counts, stamps, stamp, touched, cands, clique, ticks);
+		if (clique.size() < minsize) continue;
+		// remove all binaries of the clique
+		forall_clause(clique, k) {
+			marks[ABS(*k)] = SIGN(*k);
+		}
+		uint32 removed = 0;
+		forall_clause(clique, k) {
+			const uint32 flit = FLIP(*k);
+			forall_occurs(ot[flit], i) {
+				SCLAUSE& c = scnf[*i];
+				if (!isAMOBinary(c)) continue;
+				const uint32 other = FLIP(c[0] ^ c[1] ^ flit);
+				if (marks[ABS(other)] != SIGN(other)) continue;
+				ot.touch(c);
+				c.markDeleted();
+				removed++;
+			}
+		}
+		forall_clause(clique, k) {
+			marks[ABS(*k)] = UNDEF_VAL;
+		}
+		assert(removed >= uint32(clique.size() * (clique.size() - 1)) / 2);
+		cards.push(clique);
+		indexOT();
+		syncOT();
+		found++;
+		stats.amo.constraints++;
+		stats.amo.binaries += removed;
+		LOG2(4, "  found at-most-one constraint of %d literals replacing %d binaries", clique.size(), removed);
+	}
+	if (opts.profile_simplifier) timer.pstop(), timer.amo += timer.pcpuTime();
+	LOG2(2, " Extracted %d at-most-one constraints (%d in total)", found, cards.size());
+}
+
+// the constraints are turned back into binaries for the simplifier
+void Solver::extractCards()
+{
+	if (cards.empty()) return;
+	shrinkCards();
+	Lits_t& clause = cards.clause;
+	for (uint32 i = 0; i < cards.size(); ++i) {
+		for (uint32* x = cards.begin(i), *e = cards.end(i); x != e; ++x) {
+			for (uint32* y = x + 1; y != e; ++y) {
+				clause.clear();
+				clause.push(FLIP(*x)), clause.push(FLIP(*y));
+				SORT(clause);
+				SCLAUSE& dest = *scnf.alloc(clause);
+				dest.calcSig();
+				inf.nClauses++;
+				inf.nLiterals += 2;
+			}
+		}
+	}
+	cards.destroy();
+}
+
+// constraints over substituted literals are turned back into
+// binaries in the clause database before substitution
+void Solver::expandCards(const uint32* smallests)
+{
+	if (cards.empty()) return;
+	Lits_t& clause = cards.clause;
+	uVec1D lits, starts;
+	starts.push(0);
+	uint32 expanded = 0;
+	for (uint32 i = 0; i < cards.size(); ++i) {
+		uint32* b = cards.begin(i), *e = cards.end(i), *k;
+		for (k = b; k != e; ++k) {
+			if (smallests[*k] && NEQUAL(smallests[*k], *k)) break;
+		}
+		if (k == e) {
+			for (k = b; k != e; ++k) lits.push(*k);
+			starts.push(lits.size());
+			continue;
+		}
+		for (uint32* x = b; x != e; ++x) {
+			for (uint32* y = x + 1; y != e; ++y) {
+				clause.clear();
+				clause.push(FLIP(*x)), clause.push(FLIP(*y));
+				addClause(clause, false);
+			}
+		}
+		expanded++;
+	}
+	if (!expanded) return;
+	LOG2(2, " Expanded %d at-most-one constraints over substituted literals", expanded);
+	lits.migrateTo(cards.lits);
+	if (starts.size() == 1) starts.clear(true);
+	starts.migrateTo(cards.starts);
+	cards.attach(inf.nDualVars);
+}
+
+// remove root-level falsified literals and satisfied constraints
+void Solver::shrinkCards()
+{
+	assert(!LEVEL);
+	if (cards.empty()) return;
+	const LIT_ST* values = sp->value;
+	uVec1D lits, starts;
+	starts.push(0);
+	for (uint32 i = 0; i < cards.size(); ++i) {
+		const uint32 before = lits.size();
+		bool satisfied = false;
+		for (uint32* k = cards.begin(i), *e = cards.end(i); k != e; ++k) {
+			const uint32 lit = *k;
+			const LIT_ST val = values[lit];
+			if (val > 0) { satisfied = true; break; }
+			if (UNASSIGNED(val)) lits.push(lit);
+		}
+		if (satisfied || lits.size() - before < 2) {
+			lits.resize(before);
+			continue;
+		}
+		starts.push(lits.size());
+	}
+	lits.migrateTo(cards.lits);
+	if (starts.size() == 1) starts.clear(true);
+	starts.migrateTo(cards.starts);
+}
+
+// all other literals of constraints containing 'lit' are falsified
+bool Solver::propCards(const uint32& lit)
+{
+	CHECKLIT(lit);
+	assert(cards.watched(lit));
+	const LIT_ST* values = sp->value;
+	const uint32 level = l2dl(lit);
+	const C_REF reason = CARD_REF(lit);
+	forall_vector(uint32, cards.occurs[lit], i) {
+		for (uint32* k = cards.begin(*i), *e = cards.end(*i); k != e; ++k) {
+			const uint32 other = *k;
+			if (other == lit) continue;
+			const LIT_ST val = values[other];
+			if (!val) continue;
+			if (val > 0) {
+				Lits_t& clause = cards.clause;
+				clause.clear();
+				clause.push(FLIP(other)), clause.push(FLIP(lit));
+				if (l2dl(other) < level) std::swap(clause[0], clause[1]);
+				sp->learntLBD = 2;
+				conflict = addClause(clause, true);
+				stats.amo.conflicts++;
+				LOGCLAUSE(4, cm[conflict], "  at-most-one conflict on");
+				return true;
+			}
+			enqueue(FLIP(other), level, reason);
+			stats.amo.propagations++;
+		}
+	}
+	return false;
+}
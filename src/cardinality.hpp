@@ -0,0 +1,83 @@
+/***********************************************************************[cardinality.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __CARDINALITY_
+#define __CARDINALITY_
+
+#include "solvetypes.hpp"
+
+namespace SeqFROST {
+
+	// an implication of an at-most-one constraint is saved as a
+	// tagged reason holding the true literal that forced it
+	#define CARD_MASK		0x8000000000000000ULL
+	#define CARD_REF(LIT)	(C_REF(LIT) | CARD_MASK)
+	#define CARD_LIT(REF)	uint32((REF) & ~CARD_MASK)
+	#define CARDREASON(REF)	(((REF) & CARD_MASK) && REASON(REF))
+
+	/*****************************************************/
+	/*  Usage: native at-most-one constraints replacing  */
+	/*         their pairwise binary clauses in search;  */
+	/*         a constraint is visited once any of its   */
+	/*         literals is assigned true                 */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+
+	struct CARDS {
+		uVec1D lits, starts;
+		Vec<uVec1D> occurs;
+		CLAUSE reason;
+		Lits_t clause;
+
+		CARDS() : reason(2) { }
+
+		inline uint32	size		() const { return starts.size() ? starts.size() - 1 : 0; }
+		inline bool		empty		() const { return !size(); }
+		inline uint32*	begin		(const uint32& i) { assert(i < size()); return lits.data() + starts[i]; }
+		inline uint32*	end			(const uint32& i) { assert(i < size()); return lits.data() + starts[i + 1]; }
+		inline bool		watched		(const uint32& lit) const { return lit < occurs.size() && occurs[lit].size(); }
+		inline bool		contains	(const uint32& v) const { return watched(V2L(v)) || watched(NEG(V2L(v))); }
+		inline void		push		(const Lits_t& card) {
+			if (starts.empty()) starts.push(0);
+			for (int k = 0; k < card.size(); ++k) lits.push(card[k]);
+			starts.push(lits.size());
+		}
+		inline void		attach		(const uint32& nDualVars) {
+			occurs.clear(true);
+			if (empty()) return;
+			occurs.resize(nDualVars);
+			for (uint32 i = 0; i < size(); ++i) {
+				for (uint32* k = begin(i), *e = end(i); k != e; ++k)
+					occurs[*k].push(i);
+			}
+		}
+		// explain the implication of 'implied' by 'ref' as a binary
+		inline CLAUSE&	explain		(const C_REF& ref, const uint32& implied) {
+			assert(CARDREASON(ref));
+			reason[0] = implied, reason[1] = FLIP(CARD_LIT(ref));
+			return reason;
+		}
+		inline void		destroy		() {
+			lits.clear(true), starts.clear(true);
+			occurs.clear(true), clause.clear(true);
+		}
+	};
+
+}
+
+#endif
@@ -40,6 +40,7 @@ void Solver::removeClause(CLAUSE& c, const C_REF& cref)
 		assert(stats.literals.original > 0);
 		stats.literals.original -= size;
 		stats.shrunken += size;
+		mark_touched(c);
 	}
 	if (opts.proof_en) proof.deleteClause(c);
 	cm.collectClause(cref, size);
@@ -67,6 +68,7 @@ void Solver::addClause(const C_REF& cref, CLAUSE& c, const bool& learnt)
 		orgs.push(cref);
 		stats.clauses.original++;
 		stats.literals.original += size;
+		mark_touched(c);
 	}
 	if (keeping(c)) 
 		mark_subsume(c);
@@ -99,7 +101,7 @@ void Solver::newHyper2()
 	learntC.clear();
 }
 
-void Solver::newHyper3(const bool& learnt)
+C_REF Solver::newHyper3(const bool& learnt)
 {
 	const int size = learntC.size();
 	assert(size > 1 && size <= 3);
@@ -111,6 +113,7 @@ void Solver::newHyper3(const bool& learnt)
 	if (learnt) c.markHyper();
 	ATTACH_CLAUSE(r, c);
 	LOGCLAUSE(4, c, "  added new hyper ternary resolvent");
+	return r;
 }
 
 inline LIT_ST Solver::sortClause(CLAUSE& c, const int& start, const int& size, const bool& satonly)
@@ -221,6 +221,8 @@ namespace SeqFROST {
 
 	#define keeping(C) (C.original() || C.keep() || (C.lbd() <= limit.keptlbd && C.size() <= limit.keptsize))
 
+	#define hashable(C) (C.original() || C.lbd() <= opts.lbd_tier2)
+
 	#define mark_literals(C) \
 	{ \
 		assert(C.size() > 1); \
@@ -239,6 +241,13 @@ namespace SeqFROST {
 		} \
 	}
 
+	#define mark_touched(C) \
+	{ \
+		forall_clause(C, k) { \
+			touchVar(ABS(*k)); \
+		} \
+	}
+
 	#define mark_subsume(C) \
 	{ \
 		assert(keeping(C)); \
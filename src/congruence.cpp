@@ -0,0 +1,288 @@
+/***********************************************************************[congruence.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.hpp"
+#include "sort.hpp"
+
+using namespace SeqFROST;
+
+inline bool inTernary(const CLAUSE& c, const uint32& lit)
+{
+	assert(c.size() == 3);
+	return c[0] == lit || c[1] == lit || c[2] == lit;
+}
+
+inline bool Solver::hasTernary(Vec<BCNF>& occs, const uint32& a, const uint32& b, const uint32& c)
+{
+	uint32 x = a, y = b, z = c;
+	if (occs[y].size() < occs[x].size()) std::swap(x, y);
+	if (occs[z].size() < occs[x].size()) std::swap(x, z);
+	forall_cnf(occs[x], i) {
+		CLAUSE& t = cm[*i];
+		if (t.size() != 3) continue;
+		if (inTernary(t, y) && inTernary(t, z)) return true;
+	}
+	return false;
+}
+
+// collect AND gates 'out = (a & b & ...)' from the binaries '(-out or a)'
+// and a clause '(out or -a or -b ...)', ITE gates from four ternaries
+// and XOR gates from all clauses of their parity encoding
+inline void Solver::extractGates(Vec<GATE>& gates, uVec1D& inputs)
+{
+	const int maxarity = opts.congruence_max_arity;
+	const LIT_ST* values = sp->value;
+	const State_t* states = sp->state;
+	// occurrences of original clauses with unassigned literals
+	Vec<BCNF> occs(inf.nDualVars);
+	forall_cnf(orgs, i) {
+		const C_REF ref = *i;
+		if (cm.deleted(ref)) continue;
+		CLAUSE& c = cm[ref];
+		const int size = c.size();
+		if (size < 3 || size > maxarity) continue;
+		bool active = true;
+		forall_clause(c, k) {
+			const uint32 lit = *k;
+			if (!UNASSIGNED(values[lit]) || states[ABS(lit)].state) { active = false; break; }
+		}
+		if (!active) continue;
+		forall_clause(c, k) {
+			occs[*k].push(ref);
+		}
+	}
+	uVec1D stamps(inf.nDualVars, 0);
+	uint32 stamp = 0;
+	forall_literals(out) {
+		if (!UNASSIGNED(values[out]) || states[ABS(out)].state) continue;
+		BCNF& outs = occs[out];
+		if (outs.empty()) continue;
+		// stamp all literals implied by 'out'
+		stamp++;
+		WL& ws = wt[out];
+		forall_watches(ws, i) {
+			const WATCH w = *i;
+			if (!w.binary() || cm.deleted(w.ref)) continue;
+			stamps[w.imp] = stamp;
+		}
+		forall_cnf(outs, i) {
+			CLAUSE& c = cm[*i];
+			bool gate = true;
+			forall_clause(c, k) {
+				const uint32 lit = *k;
+				if (lit != out && stamps[FLIP(lit)] != stamp) { gate = false; break; }
+			}
+			if (!gate) continue;
+			const uint32 pos = inputs.size();
+			forall_clause(c, k) {
+				if (*k != out) inputs.push(FLIP(*k));
+			}
+			gates.push({ out, pos, inputs.size() - pos, GATE_AND, false });
+			stats.congruence.ands++;
+			LOGCLAUSE(4, c, "  found AND gate %d defined by", l2i(out));
+		}
+		if (SIGN(out)) continue;
+		// (-out or -cond or then), (out or -cond or -then)
+		// (-out or cond or else), (out or cond or -else)
+		const uint32 fout = FLIP(out);
+		BCNF& fouts = occs[fout];
+		forall_cnf(fouts, i) {
+			CLAUSE& c = cm[*i];
+			if (c.size() != 3) continue;
+			const uint32 x = c[0] ^ c[1] ^ c[2] ^ fout;
+			for (int k = 0; k < 3; ++k) {
+				const uint32 p = c[k];
+				if (p == fout || !SIGN(p)) continue; // 'cond' is positive
+				const uint32 then = x ^ p;
+				if (!hasTernary(occs, out, p, FLIP(then))) continue;
+				const uint32 cond = FLIP(p);
+				uint32 other = 0;
+				forall_cnf(fouts, j) {
+					CLAUSE& d = cm[*j];
+					if (d.size() != 3 || !inTernary(d, cond)) continue;
+					const uint32 e = d[0] ^ d[1] ^ d[2] ^ fout ^ cond;
+					if (ABS(e) == ABS(cond) || ABS(e) == ABS(then)) continue;
+					if (hasTernary(occs, out, cond, FLIP(e))) { other = e; break; }
+				}
+				if (!other) continue;
+				const uint32 pos = inputs.size();
+				inputs.push(cond), inputs.push(then), inputs.push(other);
+				gates.push({ out, pos, 3, GATE_ITE, false });
+				stats.congruence.ites++;
+				LOG2(4, "  found ITE gate %d = (%d ? %d : %d)", l2i(out), l2i(cond), l2i(then), l2i(other));
+			}
+		}
+	}
+	// every variable of an XOR is defined by the others
+	uVec1D xors;
+	extractXORs(xors, maxarity, UINT32_MAX);
+	for (uint32 x = 0; x < xors.size();) {
+		const uint32 header = xors[x];
+		const uint32 size = header >> 1;
+		const uint32* vars = xors.data() + x + 1;
+		x += size + 1;
+		uint32 k;
+		for (k = 0; k < size; ++k) {
+			if (states[vars[k]].state) break;
+		}
+		if (k < size) continue;
+		for (k = 0; k < size; ++k) {
+			const uint32 pos = inputs.size();
+			for (uint32 l = 0; l < size; ++l) {
+				if (l != k) inputs.push(V2L(vars[l]));
+			}
+			const uint32 out = V2L(vars[k]) ^ (header & 1);
+			gates.push({ out, pos, size - 1, GATE_XOR, false });
+		}
+		stats.congruence.xors++;
+	}
+}
+
+// rewrite the inputs of 'g' by their representatives into a canonical
+// form; returns false if 'g' is constant or reduced to an equivalence
+inline bool Solver::normalizeGate(GATE& g, uVec1D& inputs, EQUIVS& equivs)
+{
+	uint32* lits = inputs.data() + g.pos;
+	if (g.type == GATE_ITE) {
+		uint32 cond = equivs.find(lits[0]);
+		uint32 then = equivs.find(lits[1]);
+		uint32 other = equivs.find(lits[2]);
+		if (SIGN(cond)) cond = FLIP(cond), std::swap(then, other);
+		if (then == other) {
+			equivs.merge(g.out, then);
+			return false;
+		}
+		if (SIGN(then)) then = FLIP(then), other = FLIP(other), g.out = FLIP(g.out);
+		lits[0] = cond, lits[1] = then, lits[2] = other;
+		return true;
+	}
+	uint32 size = g.size;
+	LIT_ST parity = 0;
+	for (uint32 k = 0; k < size; ++k) {
+		const uint32 rep = equivs.find(lits[k]);
+		if (g.type == GATE_XOR) {
+			parity ^= SIGN(rep);
+			lits[k] = V2L(ABS(rep));
+		}
+		else lits[k] = rep;
+	}
+	insertionSort(lits, size);
+	uint32 j = 0;
+	for (uint32 k = 0; k < size; ++k) {
+		const uint32 lit = lits[k];
+		if (j && lits[j - 1] == lit) {
+			if (g.type == GATE_XOR) j--; // 'x ^ x' cancels out
+			continue;
+		}
+		if (g.type == GATE_AND && j && lits[j - 1] == FLIP(lit)) return false;
+		lits[j++] = lit;
+	}
+	g.size = j;
+	if (parity) g.out = FLIP(g.out);
+	if (!j) return false;
+	if (j == 1) {
+		equivs.merge(g.out, lits[0]);
+		return false;
+	}
+	return true;
+}
+
+// merge outputs of structurally equal gates until no new
+// equivalences appear, then substitute them like 'decompose'
+void Solver::congruence()
+{
+	if (!canCongruence()) return;
+	assert(!LEVEL);
+	assert(sp->propagated == trail.size());
+	stats.congruence.calls++;
+	Vec<GATE> gates;
+	uVec1D inputs;
+	extractGates(gates, inputs);
+	LOG2(2, " Congruence %lld: extracted %d gates", stats.congruence.calls, gates.size());
+	if (gates.size() < 2) return;
+	EQUIVS equivs;
+	equivs.init(inf.maxVar + 1);
+	CHASH table;
+	uint32 merged, rounds = 0;
+	do {
+		merged = 0;
+		rounds++;
+		table.reserve(gates.size());
+		for (uint32 i = 0; i < gates.size() && !equivs.contradiction; ++i) {
+			GATE& g = gates[i];
+			if (g.dead) continue;
+			if (!normalizeGate(g, inputs, equivs)) {
+				g.dead = true;
+				merged++;
+				continue;
+			}
+			const uint32* lits = inputs.data() + g.pos;
+			const uint64 hashed = fingerprint(lits, g.size) ^ hashLit(g.type);
+			const uint64 key = hashed == HASH_EMPTY ? 1 : hashed;
+			const C_REF same = table.find(key, [&](const C_REF& r) {
+				const GATE& h = gates[r];
+				if (h.type != g.type || h.size != g.size) return false;
+				const uint32* hlits = inputs.data() + h.pos;
+				for (uint32 k = 0; k < g.size; ++k)
+					if (hlits[k] != lits[k]) return false;
+				return true;
+			});
+			if (same == UNDEF_REF) {
+				table.insert(key, i);
+				continue;
+			}
+			LOG2(4, "  gate %d is congruent to gate %d", l2i(g.out), l2i(gates[same].out));
+			equivs.merge(g.out, gates[same].out);
+			g.dead = true;
+			merged++;
+		}
+	} while (merged && !equivs.contradiction);
+	table.clear(true);
+	if (equivs.contradiction) {
+		LOG2(2, " Congruence %lld: found a literal congruent to its negation", stats.congruence.calls);
+		learnEmpty();
+		return;
+	}
+	const State_t* states = sp->state;
+	uint32* smallests = sfcalloc<uint32>(inf.nDualVars);
+	uint32 substituted = 0;
+	forall_variables(v) {
+		const uint32 p = V2L(v), n = NEG(p);
+		if (states[v].state) {
+			smallests[p] = p, smallests[n] = n;
+			continue;
+		}
+		const uint32 rep = equivs.find(p);
+		assert(ABS(rep) <= v);
+		smallests[p] = rep, smallests[n] = FLIP(rep);
+		if (NEQUAL(rep, p)) substituted++;
+	}
+	equivs.destroy();
+	LOG2(2, " Congruence %lld: %d variables substituted in %d rounds", stats.congruence.calls, substituted, rounds);
+	stats.congruence.variables += substituted;
+	applySubstitution(smallests, substituted);
+	std::free(smallests), smallests = NULL;
+	printStats(substituted, 'g', CVIOLET1);
+}
+
+inline bool Solver::canCongruence()
+{
+	if (!opts.congruence_en || opts.proof_en || incremental) return false;
+	if (UNSAT || INTERRUPTED) return false;
+	return (3 * MAXCLAUSES) < (stats.searchticks + opts.decompose_min_eff);
+}
@@ -0,0 +1,93 @@
+/***********************************************************************[congruence.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __CONGRUENCE_
+#define __CONGRUENCE_
+
+#include "solvetypes.hpp"
+#include "hash.hpp"
+
+namespace SeqFROST {
+
+	#define GATE_AND	0
+	#define GATE_ITE	1
+	#define GATE_XOR	2
+
+	/*****************************************************/
+	/*  Usage: gate definition 'out = type(inputs)' with */
+	/*         its inputs saved at 'pos' in a flat       */
+	/*         buffer; XOR inputs are positive literals  */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+
+	struct GATE {
+		uint32 out, pos, size;
+		Byte type;
+		bool dead;
+	};
+
+	/*****************************************************/
+	/*  Usage: union-find over literals where every      */
+	/*         class is represented by its smallest      */
+	/*         variable as 'decompose' expects           */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+
+	class EQUIVS {
+
+		uVec1D parents; // literal equivalent to each positive variable
+
+	public:
+
+		bool contradiction;
+
+		EQUIVS() : contradiction(false) { }
+
+		inline void		init		(const uint32& nVars) {
+			parents.resize(nVars);
+			for (uint32 v = 0; v < nVars; ++v)
+				parents[v] = V2L(v);
+			contradiction = false;
+		}
+		inline bool		root		(const uint32& lit) const { return parents[ABS(lit)] == V2L(ABS(lit)); }
+		inline uint32	find		(const uint32& lit) {
+			uint32 r = lit;
+			while (!root(r)) r = parents[ABS(r)] ^ SIGN(r);
+			// compress the path to the representative
+			uint32 curr = lit;
+			while (!root(curr)) {
+				const uint32 next = parents[ABS(curr)] ^ SIGN(curr);
+				parents[ABS(curr)] = r ^ SIGN(curr);
+				curr = next;
+			}
+			return r;
+		}
+		inline bool		merge		(const uint32& a, const uint32& b) {
+			const uint32 ra = find(a), rb = find(b);
+			if (ra == rb) return false;
+			if (ra == FLIP(rb)) { contradiction = true; return false; }
+			if (ABS(ra) < ABS(rb)) parents[ABS(rb)] = ra ^ SIGN(rb);
+			else parents[ABS(ra)] = rb ^ SIGN(ra);
+			return true;
+		}
+		inline void		destroy		() { parents.clear(true); }
+	};
+
+}
+
+#endif
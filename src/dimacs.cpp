@@ -74,6 +74,8 @@ bool Solver::parser()
 				initQueue();
 				initHeap();
 				initVars();
+				if (opts.hashdup_en) 
+					chash.reserve(inf.orgCls);
 				assert(vorg.size() == inf.maxVar + 1);
 				model.init(vorg);
 				if (opts.proof_en) 
@@ -160,12 +162,23 @@ bool Solver::makeClause(Lits_t& c, Lits_t& org, char*& str)
 		}
 		else if (orgs.size() + 1 > inf.orgCls) LOGERR("too many clauses");
 		else if (newsize) {
+			uint64 key = 0;
+			if (opts.hashdup_en) {
+				key = fingerprint(c, newsize);
+				if (REASON(findDuplicate(c, newsize, key))) {
+					stats.duplicates.original++;
+					if (opts.proof_en) proof.deleteClause(org);
+					c.clear(), org.clear();
+					return true;
+				}
+			}
 			if (newsize == 2) formula.binaries++;
 			else if (newsize == 3) formula.ternaries++;
 			else assert(newsize > 3), formula.large++;
 			if (newsize > formula.maxClauseSize)
 				formula.maxClauseSize = newsize;
-			addClause(c, false);
+			const C_REF r = addClause(c, false);
+			if (opts.hashdup_en) chash.insert(key, r);
 		}
 		if (opts.proof_en && newsize < org.size()) {
 			proof.addClause(c);
@@ -0,0 +1,76 @@
+/***********************************************************************[duplicate.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.hpp"
+
+using namespace SeqFROST;
+
+// clause literals to compare with must be marked before calling
+inline bool Solver::sameClause(const C_REF& ref, const int& size)
+{
+	assert(!cm.deleted(ref));
+	CLAUSE& c = cm[ref];
+	if (c.size() != size) return false;
+	const LIT_ST* marks = sp->marks;
+	forall_clause(c, k) {
+		const uint32 lit = *k;
+		if (marks[ABS(lit)] != SIGN(lit)) return false;
+	}
+	return true;
+}
+
+// literals are marked only if a fingerprint matches
+C_REF Solver::findDuplicate(const uint32* lits, const int& size, const uint64& key, const C_REF& self)
+{
+	assert(size > 1);
+	if (chash.empty()) return UNDEF_REF;
+	bool marked = false;
+	const C_REF dref = chash.find(key, [&](const C_REF& ref) { 
+		if (ref == self || cm.deleted(ref)) return false;
+		if (!marked) {
+			for (int i = 0; i < size; ++i) markLit(lits[i]);
+			marked = true;
+		}
+		return sameClause(ref, size); 
+	});
+	if (marked) {
+		for (int i = 0; i < size; ++i) unmarkLit(lits[i]);
+	}
+	return dref;
+}
+
+void Solver::hashClauses(BCNF& cnf)
+{
+	forall_cnf(cnf, i) {
+		const C_REF r = *i;
+		if (cm.deleted(r)) continue;
+		CLAUSE& c = cm[r];
+		if (hashable(c)) 
+			chash.insert(fingerprint(c.data(), c.size()), r);
+	}
+}
+
+void Solver::hashClauses()
+{
+	if (!opts.hashdup_en) return;
+	chash.clear();
+	chash.reserve(uint32(orgs.size() + learnts.size()));
+	hashClauses(orgs);
+	hashClauses(learnts);
+	LOG2(2, " Hashed %d clauses for duplicate detection", chash.size());
+}
@@ -154,9 +154,20 @@ bool Solver::decompose()
 	std::free(dfs), dfs = NULL;
 	scc.clear();
 	litstack.clear();
+	const bool success = applySubstitution(smallests, substituted);
+	std::free(smallests), smallests = NULL;
+	return UNSAT || (substituted && success);
+}
+
+// replace every literal by its representative in 'smallests' and
+// mark substituted variables for model reconstruction
+bool Solver::applySubstitution(uint32* smallests, const uint32& substituted)
+{
+	const State_t* states = sp->state;
 	bool orgsucc = false, learntsucc = false;
 	if (substituted) {
 		assert(reduced.empty());
+		expandCards(smallests);
 		if (NOT_UNSAT) learntsucc = substitute(learnts, smallests);
 		if (NOT_UNSAT) orgsucc = substitute(orgs, smallests);
 		if (NOT_UNSAT && reduced.size()) {
@@ -196,8 +207,7 @@ bool Solver::decompose()
 			}
 		}
 	}
-	std::free(smallests), smallests = NULL;
-	return UNSAT || (substituted && (orgsucc || learntsucc));
+	return orgsucc || learntsucc;
 }
 
 bool Solver::substitute(BCNF& cnf, uint32* smallests)
@@ -55,7 +55,7 @@ inline uint32 substitute_single(const uint32& dx, SCLAUSE& org, const uint32& de
 	return 0;
 }
 
-inline bool substitute_single(const uint32& p, const uint32& n, const uint32& def, SCNF& scnf, OL& poss, OL& negs)
+inline bool substitute_single(const uint32& p, const uint32& n, const uint32& def, SCNF& scnf, OT& ot)
 {
 	CHECKLIT(def);
 	assert(!SIGN(p));
@@ -64,12 +64,16 @@ inline bool substitute_single(const uint32& p, const uint32& n, const uint32& de
 	const bool proofEN = solver->opts.proof_en;
 
 	// substitute negatives 
+	OL& negs = ot[n];
 	forall_occurs(negs, i) {
 		SCLAUSE& neg = scnf[*i];
-		if (neg.learnt() || neg.molten() || neg.has(def))
+		if (neg.learnt() || neg.molten() || neg.has(def)) {
+			ot.touch(neg);
 			neg.markDeleted();
+		}
 		else if (neg.original()) {
 			uint32 unit = substitute_single(n, neg, def_f);
+			ot.defer(def_f, *i);
 			if (unit) {
 				const LIT_ST val = solver->l2value(unit);
 				if (UNASSIGNED(val))
@@ -81,12 +85,16 @@ inline bool substitute_single(const uint32& p, const uint32& n, const uint32& de
 		}
 	}
 	// substitute positives
+	OL& poss = ot[p];
 	forall_occurs(poss, i){
 		SCLAUSE& pos = scnf[*i];
-		if (pos.learnt() || pos.molten() || pos.has(def_f))
+		if (pos.learnt() || pos.molten() || pos.has(def_f)) {
+			ot.touch(pos);
 			pos.markDeleted();
+		}
 		else if (pos.original()) {
 			uint32 unit = substitute_single(p, pos, def);
+			ot.defer(def, *i);
 			if (unit) {
 				const LIT_ST val = solver->l2value(unit);
 				if (UNASSIGNED(val))
@@ -97,6 +105,9 @@ inline bool substitute_single(const uint32& p, const uint32& n, const uint32& de
 				solver->proof.addResolvent(pos);
 		}
 	}
+	// substituted clauses reach 'def' lists on the next update
+	negs.clear(true), poss.clear(true);
+	ot.touch(n), ot.touch(p);
 	return false; 
 }
 
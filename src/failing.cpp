@@ -90,6 +90,210 @@ inline uint32 Solver::nextProbe()
 	return 0;
 }
 
+enum { PROBE_SKIPPED, PROBE_DECIDED, PROBE_IMPLIED, PROBE_FAILED };
+
+void Solver::treeProbes(Vec<PROBENODE>& tree)
+{
+	assert(tree.empty());
+	const uint32* hist = vhist.data();
+	const LIT_ST* values = sp->value;
+	const State_t* states = sp->state;
+	uVec1D walks(inf.nDualVars, 0), parents(inf.nDualVars, 0), order;
+	BCNF edges(inf.nDualVars, UNDEF_REF);
+	// every probe climbs to the unassigned literal it implies with
+	// most binary occurrences until it meets the forest or a cycle
+	uint32 walk = 0;
+	while (probes.size()) {
+		uint32 lit = probes.back();
+		CHECKLIT(lit);
+		probes.pop();
+		if (states[ABS(lit)].state || !UNASSIGNED(values[lit]) || walks[lit]) continue;
+		walk++;
+		while (true) {
+			walks[lit] = walk;
+			order.push(lit);
+			uint32 parent = 0;
+			C_REF edge = UNDEF_REF;
+			WL& ws = wt[lit];
+			forall_watches(ws, i) {
+				const WATCH w = *i;
+				if (!w.binary()) continue;
+				const uint32 imp = w.imp;
+				CHECKLIT(imp);
+				if (states[ABS(imp)].state || !UNASSIGNED(values[imp]) || cm.deleted(w.ref)) continue;
+				if (!parent || hist[imp] > hist[parent]) 
+					parent = imp, edge = w.ref;
+			}
+			if (!parent || walks[parent] == walk) break;
+			parents[lit] = parent, edges[lit] = edge;
+			if (walks[parent]) break;
+			lit = parent;
+		}
+	}
+	// list every subtree right after its root in depth-first order,
+	// keeping roots and siblings in the order they were scheduled
+	const uint32 nodes = order.size();
+	uVec1D children(inf.nDualVars, 0), siblings(inf.nDualVars, 0), stack;
+	for (uint32 i = 0; i < nodes; ++i) {
+		const uint32 lit = order[i], parent = parents[lit];
+		if (!parent) continue;
+		siblings[lit] = children[parent];
+		children[parent] = lit;
+	}
+	uint32* index = walks.data();
+	tree.reserve(nodes);
+	for (uint32 i = 0; i < nodes; ++i) {
+		const uint32 root = order[i];
+		if (parents[root]) continue;
+		stack.push(root);
+		while (stack.size()) {
+			const uint32 lit = stack.back();
+			stack.pop();
+			const uint32 parent = parents[lit];
+			index[lit] = tree.size();
+			tree.push(PROBENODE(lit, parent ? index[parent] : UINT32_MAX, edges[lit]));
+			for (uint32 child = children[lit]; child; child = siblings[child])
+				stack.push(child);
+		}
+	}
+	assert(tree.size() == nodes);
+	for (uint32 i = nodes; i--;) {
+		PROBENODE& node = tree[i];
+		if (!node.end) node.end = i + 1;
+		if (node.parent != UINT32_MAX) {
+			assert(node.parent < i);
+			uint32& end = tree[node.parent].end;
+			if (end < node.end) end = node.end;
+		}
+	}
+	LOG2(2, "  built a forest of %d probes over %d scheduled", nodes, walk);
+}
+
+inline void Solver::leaveProbe(const Vec<PROBENODE>& tree, uVec1D& path)
+{
+	assert(path.size() == LEVEL);
+	path.pop();
+	backtrack(path.size());
+	if (path.size()) 
+		sp->source[ABS(tree[path.back()].lit)] = UNDEF_REF;
+}
+
+inline int Solver::decideProbe(const Vec<PROBENODE>& tree, uVec1D& path, const uint32& i, uint32* numfailed, uint32& currfailed)
+{
+	assert(path.size() == LEVEL);
+	const PROBENODE& node = tree[i];
+	const uint32 probe = node.lit;
+	CHECKLIT(probe);
+	if (sp->state[ABS(probe)].state) return PROBE_SKIPPED;
+	const LIT_ST val = sp->value[probe];
+	if (!UNASSIGNED(val)) {
+		// children of a satisfied probe are still worth probing
+		if (val) return PROBE_IMPLIED;
+		if (!l2dl(probe)) return PROBE_SKIPPED;
+		// implied false by its own ancestors
+		LOG2(4, "  probe %d is falsified by its parents", l2i(probe));
+		currfailed++;
+		path.clear();
+		backtrack();
+		enqueueUnit(FLIP(probe));
+		if (BCP()) {
+			LOG2(2, "  failed probe %d proved a contradiction", l2i(probe));
+			learnEmpty();
+		}
+		return PROBE_FAILED;
+	}
+	// a leaf implied by a probe since the last failure cannot fail
+	if (currfailed && numfailed[probe] == currfailed && node.end == i + 1) return PROBE_SKIPPED;
+	if (path.size()) {
+		const uint32 parent = path.back();
+		if (node.parent == parent) {
+			assert(!cm.deleted(node.edge));
+			sp->source[ABS(tree[parent].lit)] = node.edge;
+		}
+		else {
+			// the parent of 'probe' is either implied by the path
+			// or a root unit
+			assert(sp->value[tree[node.parent].lit] > 0);
+			if (!l2dl(tree[node.parent].lit))
+				while (path.size()) leaveProbe(tree, path);
+		}
+	}
+	const uint32 propagated = sp->propagated;
+	enqueueDecision(probe);
+	path.push(i);
+	if (!BCPProbe()) {
+		const uint32 trailsize = trail.size();
+		for (uint32 k = propagated; k < trailsize; ++k)
+			numfailed[trail[k]] = currfailed;
+		return PROBE_DECIDED;
+	}
+	currfailed++;
+	if (LEVEL == 1) {
+		analyze();
+		assert(!LEVEL);
+		if (UNASSIGNED(sp->value[probe]))
+			enqueueUnit(FLIP(probe));
+	}
+	else {
+		// 'probe' implies all decisions below it
+		backtrack();
+		enqueueUnit(FLIP(probe));
+	}
+	path.clear();
+	if (BCP()) {
+		LOG2(2, "  failed probe %d proved a contradiction", l2i(probe));
+		learnEmpty();
+	}
+	return PROBE_FAILED;
+}
+
+void Solver::probeTree(const Vec<PROBENODE>& tree, const uint64& limit, uint32& currprobed, uint32& currfailed)
+{
+	State_t* states = sp->state;
+	uint32* numfailed = vhist.data();
+	memset(numfailed, 0, sizeof(uint32) * inf.nDualVars);
+	uVec1D path, chain;
+	const uint32 nodes = tree.size();
+	uint32 i = 0;
+	while (i < nodes && stats.probeticks < limit && NOT_UNSAT && !INTERRUPTED) {
+		while (path.size() && tree[path.back()].end <= i) 
+			leaveProbe(tree, path);
+		assert(sp->propagated == trail.size());
+		// parents lost by a failed probe are decided again
+		chain.clear();
+		chain.push(i);
+		for (uint32 a = tree[i].parent; a != UINT32_MAX && (path.empty() || a != path.back()); a = tree[a].parent)
+			chain.push(a);
+		int decided = PROBE_DECIDED;
+		while (chain.size()) {
+			const uint32 k = chain.back();
+			chain.pop();
+			if (k == i) states[ABS(tree[i].lit)].probe = 0;
+			decided = decideProbe(tree, path, k, numfailed, currfailed);
+			if (decided == PROBE_SKIPPED || decided == PROBE_FAILED) {
+				i = tree[k].end;
+				break;
+			}
+		}
+		if (decided == PROBE_DECIDED || decided == PROBE_IMPLIED) {
+			if (decided == PROBE_DECIDED) {
+				currprobed++;
+				if (path.size() > 1) stats.probe.stacked++;
+			}
+			i++;
+		}
+	}
+	path.clear();
+	backtrack();
+	// unvisited probes are left to the remaining logic 
+	const LIT_ST* values = sp->value;
+	for (uint32 k = nodes; k-- > i;) {
+		const uint32 probe = tree[k].lit;
+		if (!states[ABS(probe)].state && UNASSIGNED(values[probe]))
+			probes.push(probe);
+	}
+}
+
 void Solver::failing()
 {
 	if (UNSAT) return;
@@ -121,42 +325,48 @@ void Solver::failing()
 			break;
 		}
 
-		uint32* numfailed = vhist.data();
-		memset(numfailed, 0, sizeof(uint32) * inf.nDualVars);
-
 		stats.probe.rounds++;
 
 		currprobed = currfailed = 0;
-		while ((probe = nextProbe())
-			&& stats.probeticks < probe_limit
-			&& NOT_UNSAT && !INTERRUPTED)
-		{
-			assert(!LEVEL);
-			assert(unassigned(probe));
-			assert(sp->propagated == trail.size());
-			states[ABS(probe)].probe = 0;
-			if (currfailed && numfailed[probe] == currfailed) continue;
-			currprobed++;
-			enqueueDecision(probe);
-			const uint32 propagated = sp->propagated;
-			if (BCPProbe()) {
-				currfailed++;
-				analyze();
+		if (opts.probe_tree_en) {
+			Vec<PROBENODE> tree;
+			treeProbes(tree);
+			probeTree(tree, probe_limit, currprobed, currfailed);
+		}
+		else {
+			uint32* numfailed = vhist.data();
+			memset(numfailed, 0, sizeof(uint32) * inf.nDualVars);
+			while ((probe = nextProbe())
+				&& stats.probeticks < probe_limit
+				&& NOT_UNSAT && !INTERRUPTED)
+			{
 				assert(!LEVEL);
-				if (UNASSIGNED(values[probe]))
-					enqueueUnit(FLIP(probe));
-				if (BCP()) {
-					LOG2(2, "  failed probe %d proved a contradiction", l2i(probe));
-					learnEmpty();
-				}
-			}
-			else {
-				assert(LEVEL == 1);
+				assert(unassigned(probe));
 				assert(sp->propagated == trail.size());
-				const uint32 trailsize = trail.size();
-				for (uint32 i = propagated; i < trailsize; ++i)
-					numfailed[trail[i]] = currfailed;
-				backtrack();
+				states[ABS(probe)].probe = 0;
+				if (currfailed && numfailed[probe] == currfailed) continue;
+				currprobed++;
+				enqueueDecision(probe);
+				const uint32 propagated = sp->propagated;
+				if (BCPProbe()) {
+					currfailed++;
+					analyze();
+					assert(!LEVEL);
+					if (UNASSIGNED(values[probe]))
+						enqueueUnit(FLIP(probe));
+					if (BCP()) {
+						LOG2(2, "  failed probe %d proved a contradiction", l2i(probe));
+						learnEmpty();
+					}
+				}
+				else {
+					assert(LEVEL == 1);
+					assert(sp->propagated == trail.size());
+					const uint32 trailsize = trail.size();
+					for (uint32 i = propagated; i < trailsize; ++i)
+						numfailed[trail[i]] = currfailed;
+					backtrack();
+				}
 			}
 		}
 
@@ -26,6 +26,16 @@ struct SUBSUME_RANK {
 	inline uint32 operator () (const CSIZE& a) const { return a.size; }
 };
 
+// a clause can only subsume or strengthen clauses with all of its variables
+inline uint64 varsig(CLAUSE& c)
+{
+	uint64 sig = 0;
+	forall_clause(c, k) {
+		sig |= 1ULL << (ABS(*k) & 63);
+	}
+	return sig;
+}
+
 inline void Solver::strengthen(CLAUSE& c, const uint32& self) 
 {
 	CHECKLIT(self);
@@ -40,6 +50,7 @@ inline void Solver::strengthen(CLAUSE& c, const uint32& self)
 			*j++ = lit;
 	}
 	assert(j + 1 == c.end());
+	if (c.original()) touchVar(ABS(self));
 	shrinkClause(c, 1);
 	c.initTier3();
 }
@@ -95,6 +106,7 @@ inline CL_ST Solver::subsumeClause(CLAUSE& c, const cbucket_t* cs, const bool* d
 	mark_literals(c);   
 
 	const LIT_ST* marks = sp->marks;
+	const uint64 csig = varsig(c);
 	CLAUSE* s = NULL;
 	uint32 self = 0;
 	forall_clause(c, k) {
@@ -124,9 +136,13 @@ inline CL_ST Solver::subsumeClause(CLAUSE& c, const cbucket_t* cs, const bool* d
 
 			if (s) break;
 
-			WOL& wol = wot[slit];
-			forall_wol(wol, i) {
-				const C_REF dref = *i;
+			FOL& fol = fot[slit];
+			forall_fol(fol, i) {
+				if (i->sig & ~csig) {
+					stats.forward.filtered++;
+					continue;
+				}
+				const C_REF dref = i->ref;
 				if (deleted[dref]) continue;
 				GET_CLAUSE_PTR(d, dref, cs);
 				assert(d != &c);
@@ -242,7 +258,7 @@ void Solver::forwardAll()
 			}
 		}
 		
-		wot.resize(inf.nDualVars);
+		fot.resize(inf.nDualVars);
 		bot.resize(inf.nDualVars);
 
 		forall_vector(CSIZE, scheduled, i) {
@@ -256,6 +272,19 @@ void Solver::forwardAll()
 			assert(!cm.deleted(r));
 
 			LOGCLAUSE(4, c, "  subsuming ");
+
+			// exact duplicates are cheaper to find via the clause hash index
+			if (opts.hashdup_en && c.size() > 2) {
+				const C_REF dref = findDuplicate(c, c.size(), fingerprint(c, c.size()), r);
+				if (REASON(dref)) {
+					LOGCLAUSE(3, cm[dref], "  found duplicate ");
+					removeSubsumed(c, r, cm.clause(dref));
+					stats.duplicates.forward++;
+					subsumed++;
+					continue;
+				}
+			}
+
 			if (c.size() > 2 && c.subsume()) {
 				c.initSubsume();
 				CL_ST st = subsumeClause(c, cs, deleted, states, r);
@@ -268,7 +297,7 @@ void Solver::forwardAll()
 			forall_clause(c, k) {
 				const uint32 lit = *k;
 				if (!states[ABS(lit)].subsume) subsume = false;
-				const uint32 currentsize = orgbin ? bot[lit].size() : wot[lit].size();
+				const uint32 currentsize = orgbin ? bot[lit].size() : fot[lit].size();
 				if (minlit && minsize <= currentsize) continue;
 				const uint32 h = hist[lit];
 				if (minlit && minsize == currentsize && h <= minhist) continue;
@@ -283,7 +312,7 @@ void Solver::forwardAll()
 				if (orgbin)
 					bot[minlit].push(c[0] ^ c[1] ^ minlit);
 				else
-					wot[minlit].push(r);
+					fot[minlit].push({ r, varsig(c) });
 			}
 		}
 	}
@@ -298,7 +327,7 @@ void Solver::forwardAll()
 		mark_subsume(c);
 	}
 
-	wot.clear(true);
+	fot.clear(true);
 	bot.clear(true);
 	vhist.clear(true);
 	shrunken.clear(true);
@@ -37,18 +37,23 @@ inline void truefun(Fun f)
 		f[i] = ALLONES;
 }
 
+// loops below have no early exits nor carried counters
+// so that the compiler can vectorize them at any core size
+
 inline bool isfalsefun(const Fun f) 
 {
+	uint64 any = 0;
 	for (uint32 i = 0; i < FUNTABLEN; ++i)
-		if (f[i]) return false;
-	return true;
+		any |= f[i];
+	return !any;
 }
 
 inline bool istruefun(const Fun f) 
 {
+	uint64 all = ALLONES;
 	for (uint32 i = 0; i < FUNTABLEN; ++i)
-		if (f[i] != ALLONES) return false;
-	return true;
+		all &= f[i];
+	return all == ALLONES;
 }
 
 inline void orfun(Fun a, const Fun b) 
@@ -79,16 +84,11 @@ inline void clause2fun(const int& v, const bool& sign, Fun f)
 			f[i] |= val;
 	}
 	else {
-		uint64 val = sign ? ALLONES : 0ULL;
-		int j = 0;
-		int sv = 1 << (v - 6);
-		for (uint32 i = 0; i < FUNTABLEN; ++i) {
-			f[i] |= val;
-			if (++j >= sv) {
-				val = ~val;
-				j = 0;
-			}
-		}
+		// whole words are true where bit 'v - 6' of their index differs from 'sign'
+		const uint32 shift = v - 6;
+		const uint64 flip = sign;
+		for (uint32 i = 0; i < FUNTABLEN; ++i)
+			f[i] |= 0ULL - (((i >> shift) & 1ULL) ^ flip);
 	}
 }
 
@@ -108,8 +108,9 @@ inline bool countMinResolvents(const uint32& x, const int& clsbefore, SCNF& scnf
 				if (cj.original()) {
 					const bool b = cj.molten();
 					int rsize;
-					if ((!a || !b) && (rsize = merge(x, ci, cj)) > 1) {
-						if (++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return true;
+					if ((!a || !b) && (rsize = merge(x, ci, cj))) {
+						// unit resolvents are left to self-subsumption
+						if (rsize == 1 || ++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return true;
 						nAddedLits += rsize;
 					}
 				}
@@ -161,17 +162,28 @@ inline bool buildfuntab(const uint32& lit, SCNF& scnf, OT& ot, Fun f)
 	return true;
 }
 
-inline void buildfuntab(const uint32& lit, const int& tail, SCNF& scnf, const OL& ol, Fun fun, bool& core)
+// a clause of 'ol' is not in the core if 'prefix' anded with the clauses 
+// before it is already false; 'prefix' is extended by one clause at a time
+// so that every clause is converted to a function once
+inline void buildcoretab(const uint32& lit, SCNF& scnf, OL& ol, Fun prefix, bool& core)
 {
 	CHECKLIT(lit);
-	LOGCLAUSE(4, scnf[ol[tail]], "   ignoring");
 
 	Fun cls;
 
-	for (int j = 0; j < tail; ++j) {
-		SCLAUSE& c = scnf[ol[j]];
+	bool unsat = isfalsefun(prefix);
+	forall_occurs(ol, i) {
+		SCLAUSE& c = scnf[*i];
 		if (c.learnt()) continue;
 		assert(!c.deleted());
+
+		if (unsat) {
+			LOGCLAUSE(4, c, "   ignoring");
+			c.melt(); // non-gate clause (not resolved with its kind)
+			core = true;
+			continue;
+		}
+
 		LOGCLAUSE(4, c, "   anding");
 
 		falsefun(cls);
@@ -188,12 +200,8 @@ inline void buildfuntab(const uint32& lit, const int& tail, SCNF& scnf, const OL
 		assert(!isfalsefun(cls));
 		assert(!istruefun(cls));
 
-		andfun(fun, cls);
-	}
-
-	if (isfalsefun(fun)) {
-		scnf[ol[tail]].melt(); // non-gate clause (not resolved with its kind)
-		core = true;
+		andfun(prefix, cls);
+		unsat = isfalsefun(prefix);
 	}
 }
 
@@ -209,7 +217,7 @@ inline uint64 collapsefun(uint64& allzero, const Fun b, const Fun c)
 }
 
 inline bool find_fun_gate(const uint32& p, const int& orgCls, SCNF& scnf, OT& ot, 
-	int& nAddedCls, int& nAddedLits)
+	int& nAddedCls, int& nAddedLits, bool& contradiction)
 {
 	if (!solver->opts.ve_fun_en) return 0;
 	const uint32 n = NEG(p);
@@ -217,27 +225,18 @@ inline bool find_fun_gate(const uint32& p, const int& orgCls, SCNF& scnf, OT& ot
 	if (buildfuntab (p, scnf, ot, pos) && buildfuntab (n, scnf, ot, neg)) {
 		uint64 allzero = 0;
 		if (!collapsefun(allzero, pos, neg)) {
-			solver->cnfstate = UNSAT_M;
+			contradiction = true;
 			return true;
 		}
 		if (!allzero) {
 			Fun& fun = pos;
 			LOG2 (4, "  extracting core for %d..", l2i(p));
-			OL& poss = ot[p];
-			int start = poss.size() - 1;
+			OL& poss = ot[p], &negs = ot[n];
 			bool core = false;
-			for (int i = start; i >= 0; --i) {
-				copyfun(fun, neg);
-				if (scnf[poss[i]].original()) 
-					buildfuntab(p, i, scnf, poss, fun, core);
-			}
-			OL& negs = ot[n];
-			start = negs.size() - 1;
-			for (int i = start; i >= 0; --i) {
-				truefun(fun);
-				if (scnf[negs[i]].original()) 
-					buildfuntab(n, i, scnf, negs, fun, core);
-			}
+			copyfun(fun, neg);
+			buildcoretab(p, scnf, poss, fun, core);
+			truefun(fun);
+			buildcoretab(n, scnf, negs, fun, core);
 			LOGOCCURS(solver, 4, ABS(p));
 			// check addibility
 			nAddedCls = 0, nAddedLits = 0;
@@ -0,0 +1,390 @@
+/***********************************************************************[gauss.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.hpp"
+#include "sort.hpp"
+
+using namespace SeqFROST;
+
+// collect XORs encoded by all 2^(k-1) clauses over the same 'k'
+// variables, with k up to 'maxarity', into at most 'maxrows' rows
+uint32 Solver::extractXORs(uVec1D& xors, const int& maxarity, const uint32& maxrows)
+{
+	const LIT_ST* values = sp->value;
+	uVec1D lits;
+	Vec<XCAND> cands;
+	forall_cnf(orgs, i) {
+		const C_REF ref = *i;
+		if (cm.deleted(ref)) continue;
+		CLAUSE& c = cm[ref];
+		const int size = c.size();
+		if (size < 3 || size > maxarity) continue;
+		const uint32 pos = lits.size();
+		forall_clause(c, k) {
+			lits.push(*k);
+		}
+		insertionSort(lits.data() + pos, size);
+		cands.push({ pos, uint32(size) });
+	}
+	if (cands.size() < 4) return 0;
+	QSORTCMP(cands, XCAND_CMP(lits.data()));
+	uint32 found = 0;
+	for (uint32 i = 0, j; i < cands.size() && found < maxrows; i = j) {
+		const XCAND& first = cands[i];
+		const uint32 k = first.size;
+		const uint32* xlits = lits.data() + first.pos;
+		// forbidden assignments are given by the clause signs
+		uint64 forbidden = 0;
+		for (j = i; j < cands.size(); ++j) {
+			const XCAND& cand = cands[j];
+			if (cand.size != k) break;
+			const uint32* clits = lits.data() + cand.pos;
+			uint32 pattern = 0, l;
+			for (l = 0; l < k; ++l) {
+				if (ABS(clits[l]) != ABS(xlits[l])) break;
+				pattern |= uint32(SIGN(clits[l])) << l;
+			}
+			if (l < k) break;
+			forbidden |= 1ULL << pattern;
+		}
+		if (j - i < (1U << (k - 1))) continue;
+		uint64 even = 0, odd = 0;
+		for (uint32 p = 0; p < (1U << k); ++p) {
+			LIT_ST parity = 0;
+			for (uint32 t = p; t; t &= t - 1) parity ^= 1;
+			if (parity) odd |= 1ULL << p;
+			else even |= 1ULL << p;
+		}
+		for (LIT_ST parity = 0; parity < 2; parity++) {
+			// all assignments of 'parity' are forbidden
+			const uint64 mask = parity ? odd : even;
+			if ((forbidden & mask) != mask) continue;
+			LIT_ST rhs = !parity;
+			const uint32 start = xors.size();
+			xors.push(0);
+			for (uint32 l = 0; l < k; ++l) {
+				const uint32 v = ABS(xlits[l]);
+				const LIT_ST val = values[V2L(v)];
+				if (UNASSIGNED(val)) xors.push(v);
+				else rhs ^= val;
+			}
+			xors[start] = ((xors.size() - start - 1) << 1) | uint32(rhs);
+			found++;
+		}
+	}
+	return found;
+}
+
+void Solver::buildGauss()
+{
+	gauss.destroy();
+	if (!opts.gauss_en || opts.proof_en || incremental) return;
+	if (!UNSOLVED || orgs.empty()) return;
+	assert(!LEVEL);
+	assert(conflict == UNDEF_REF);
+	LOG2(2, " Extracting XOR constraints for Gauss-Jordan elimination..");
+	stats.gauss.calls++;
+	// each XOR is saved as (size << 1 | rhs) followed by its variables
+	uVec1D xors;
+	const uint32 nxors = extractXORs(xors, opts.gauss_max_arity, opts.gauss_max_rows);
+	if (!nxors) {
+		LOG2(2, "  no XOR constraints found");
+		return;
+	}
+	stats.gauss.xors += nxors;
+	// assign columns to variables in order of appearance
+	gauss.varcol.resize(inf.maxVar + 1, 0);
+	for (uint32 i = 0; i < xors.size(); i += (xors[i] >> 1) + 1) {
+		const uint32 size = xors[i] >> 1;
+		for (uint32 l = 1; l <= size; ++l) {
+			const uint32 v = xors[i + l];
+			if (!gauss.varcol[v]) {
+				gauss.colvar.push(v);
+				gauss.varcol[v] = gauss.colvar.size();
+			}
+		}
+	}
+	// fill the bit-packed rows
+	GAUSS& g = gauss;
+	g.ncols = g.colvar.size();
+	g.nwords = (g.ncols + 63) >> 6;
+	g.nrows = nxors;
+	g.rows.resize(size_t(g.nrows) * g.nwords, 0);
+	g.rhs.resize(g.nrows, 0);
+	for (uint32 i = 0, r = 0; i < xors.size(); i += (xors[i] >> 1) + 1, r++) {
+		const uint32 size = xors[i] >> 1;
+		uint64* row = g.row(r);
+		for (uint32 l = 1; l <= size; ++l)
+			g.toggle(row, g.varcol[xors[i + l]] - 1);
+		g.rhs[r] = xors[i] & 1;
+	}
+	xors.clear(true);
+	// reduce to reduced row echelon form
+	g.basic.resize(g.nrows, GAUSS_NOCOL);
+	uint32 rank = 0;
+	for (uint32 col = 0; col < g.ncols && rank < g.nrows; ++col) {
+		const uint32 w = GAUSS_WORD(col);
+		const uint64 bit = GAUSS_BIT(col);
+		uint32 pivot = rank;
+		while (pivot < g.nrows && !(g.row(pivot)[w] & bit)) pivot++;
+		if (pivot == g.nrows) continue;
+		if (pivot != rank) g.swapRows(pivot, rank);
+		for (uint32 r = 0; r < g.nrows; ++r) {
+			if (r != rank && (g.row(r)[w] & bit))
+				g.addRow(r, rank);
+		}
+		g.basic[rank++] = col;
+	}
+	// a remaining row with odd parity is a contradiction
+	for (uint32 r = rank; r < g.nrows; ++r) {
+		if (g.rhs[r]) {
+			LOG2(2, "  Gauss-Jordan elimination proved a contradiction");
+			gauss.destroy();
+			learnEmpty();
+			return;
+		}
+	}
+	// remove unit rows and attach watches to the others
+	g.propagated = trail.size();
+	g.colrow.resize(g.ncols, GAUSS_NOROW);
+	g.watchers.resize(g.ncols);
+	g.watch.resize(rank, GAUSS_NOCOL);
+	uint32 units = 0, nrows = 0;
+	for (uint32 r = 0; r < rank; ++r) {
+		uint64* row = g.row(r);
+		const uint32 b = g.basic[r];
+		uint32 nonbasic = GAUSS_NOCOL;
+		forall_gauss_row(row, g.nwords, col) {
+			if (col != b && nonbasic == GAUSS_NOCOL) nonbasic = col;
+		}
+		if (nonbasic == GAUSS_NOCOL) {
+			const uint32 v = g.colvar[b];
+			const uint32 unit = g.rhs[r] ? V2L(v) : NEG(V2L(v));
+			if (unassigned(unit)) enqueueUnit(unit), units++;
+			continue;
+		}
+		if (nrows != r) {
+			std::memcpy(g.row(nrows), row, sizeof(uint64) * g.nwords);
+			g.rhs[nrows] = g.rhs[r];
+			g.basic[nrows] = b;
+		}
+		g.colrow[b] = nrows;
+		g.setWatch(nrows, nonbasic);
+		nrows++;
+	}
+	g.nrows = nrows;
+	g.rows.resize(size_t(nrows) * g.nwords);
+	g.rhs.resize(nrows), g.basic.resize(nrows), g.watch.resize(nrows);
+	g.stamps.resize(nrows, 0);
+	stats.gauss.units += units;
+	LOG2(2, " Gauss-Jordan matrix of %d XORs has %d rows and %d columns (%d units found)", nxors, nrows, g.ncols, units);
+	if (!nrows) gauss.destroy();
+	if (units && BCP()) {
+		LOG2(2, "  Propagation after Gauss-Jordan elimination proved a contradiction");
+		learnEmpty();
+	}
+}
+
+// materialize the XOR row 'r' as a clause whose literals are all
+// falsified except 'implied' (if any); the two highest-level
+// literals after the implied one are moved to the front
+inline C_REF Solver::gaussClause(const uint32& r, const uint32& implied)
+{
+	const LIT_ST* values = sp->value;
+	Lits_t& clause = gauss.clause;
+	clause.clear();
+	if (implied) clause.push(implied);
+	const uint32 first = clause.size();
+	const uint64* row = gauss.row(r);
+	forall_gauss_row(row, gauss.nwords, col) {
+		const uint32 lit = V2L(gauss.colvar[col]);
+		if (ABS(lit) == ABS(implied)) continue;
+		assert(!unassigned(lit));
+		clause.push(values[lit] ? FLIP(lit) : lit);
+	}
+	const int size = clause.size();
+	assert(size > 1);
+	for (int i = first; i < 2; ++i) {
+		int maxpos = i;
+		for (int k = i + 1; k < size; ++k) {
+			if (l2dl(clause[k]) > l2dl(clause[maxpos]))
+				maxpos = k;
+		}
+		std::swap(clause[i], clause[maxpos]);
+	}
+	sp->learntLBD = size;
+	return addClause(clause, true);
+}
+
+// recheck row 'r' after its watch is assigned or it is modified
+// by a pivot; returns false if the row is falsified
+inline bool Solver::checkGauss(const uint32& r)
+{
+	GAUSS& g = gauss;
+	const LIT_ST* values = sp->value;
+	const uint32* levels = sp->level;
+	const uint64* row = g.row(r);
+	const uint32 b = g.basic[r], w = g.watch[r];
+	if (w != b && g.has(row, w)
+		&& UNASSIGNED(values[V2L(g.colvar[w])])
+		&& UNASSIGNED(values[V2L(g.colvar[b])]))
+		return true;
+	uint32 nfree = 0, freecol = GAUSS_NOCOL, newwatch = GAUSS_NOCOL;
+	uint32 maxcol = GAUSS_NOCOL, maxlevel = 0;
+	LIT_ST parity = g.rhs[r];
+	forall_gauss_row(row, g.nwords, col) {
+		const uint32 v = g.colvar[col];
+		const LIT_ST val = values[V2L(v)];
+		if (UNASSIGNED(val)) {
+			nfree++, freecol = col;
+			if (col != b && newwatch == GAUSS_NOCOL) newwatch = col;
+			if (nfree > 1 && newwatch != GAUSS_NOCOL) {
+				g.setWatch(r, newwatch);
+				return true;
+			}
+		}
+		else {
+			parity ^= val;
+			if (col != b && (maxcol == GAUSS_NOCOL || levels[v] > maxlevel))
+				maxcol = col, maxlevel = levels[v];
+		}
+	}
+	assert(nfree <= 1);
+	if (nfree) {
+		g.setWatch(r, freecol != b ? freecol : maxcol);
+		const uint32 v = g.colvar[freecol];
+		if (sp->state[v].state) return true;
+		const uint32 lit = parity ? V2L(v) : NEG(V2L(v));
+		stats.gauss.propagations++;
+		if (!LEVEL) {
+			enqueueUnit(lit);
+			return true;
+		}
+		const C_REF ref = gaussClause(r, lit);
+		LOGCLAUSE(4, cm[ref], "  Gauss-Jordan propagated %d by", l2i(lit));
+		enqueue(lit, l2dl(gauss.clause[1]), ref);
+		// binaries are watched without checking deletion, so they stay
+		if (gauss.clause.size() > 2) g.reasons.push(ref);
+		return true;
+	}
+	assert(maxcol != GAUSS_NOCOL);
+	g.setWatch(r, maxcol);
+	if (!parity) return true;
+	stats.gauss.conflicts++;
+	conflict = gaussClause(r, 0);
+	LOGCLAUSE(4, cm[conflict], "  Gauss-Jordan conflict on");
+	return false;
+}
+
+// the basic column 'col' of row 'r' is assigned; pivot on an
+// unassigned non-basic column to keep the basic unassigned
+inline bool Solver::pivotGauss(const uint32& r, const uint32& col)
+{
+	GAUSS& g = gauss;
+	const LIT_ST* values = sp->value;
+	uint32 u = GAUSS_NOCOL;
+	const uint64* row = g.row(r);
+	forall_gauss_row(row, g.nwords, k) {
+		if (u == GAUSS_NOCOL && k != col && UNASSIGNED(values[V2L(g.colvar[k])]))
+			u = k;
+	}
+	if (u == GAUSS_NOCOL) return checkGauss(r);
+	// eliminate 'u' from the other rows
+	const uint32 w = GAUSS_WORD(u);
+	const uint64 bit = GAUSS_BIT(u);
+	g.modified.clear();
+	for (uint32 i = 0; i < g.nrows; ++i) {
+		if (i != r && (g.row(i)[w] & bit)) {
+			g.addRow(i, r);
+			g.modified.push(i);
+		}
+	}
+	g.colrow[col] = GAUSS_NOROW;
+	g.colrow[u] = r;
+	g.basic[r] = u;
+	stats.gauss.pivots++;
+	if (!checkGauss(r)) return false;
+	forall_vector(uint32, g.modified, i) {
+		if (!checkGauss(*i)) return false;
+	}
+	return true;
+}
+
+inline bool Solver::watchGauss(const uint32& col)
+{
+	GAUSS& g = gauss;
+	uVec1D& ws = g.watchers[col];
+	const uint64 stamp = ++g.stamp;
+	bool falsified = false;
+	uint32* i = ws, * j = i, * end = ws.end();
+	while (i != end) {
+		const uint32 r = *i++;
+		// drop stale and duplicated watches
+		if (g.watch[r] != col || g.stamps[r] == stamp) continue;
+		g.stamps[r] = stamp;
+		*j++ = r;
+		if (falsified) continue;
+		falsified = !checkGauss(r);
+		if (g.watch[r] != col) j--;
+	}
+	ws.shrink(uint32(end - j));
+	return !falsified;
+}
+
+bool Solver::propGauss()
+{
+	assert(gauss.nrows);
+	if (gauss.propagated > trail.size())
+		gauss.propagated = trail.size();
+	while (gauss.propagated < trail.size()) {
+		const uint32 v = ABS(trail[gauss.propagated++]);
+		if (v >= gauss.varcol.size()) continue;
+		uint32 col = gauss.varcol[v];
+		if (!col--) continue;
+		const uint32 r = gauss.colrow[col];
+		if (r != GAUSS_NOROW && !pivotGauss(r, col)) return true;
+		if (!watchGauss(col)) return true;
+	}
+	return false;
+}
+
+// reason clauses are only kept while they are reasons, as they
+// can be derived again from the matrix on demand; the implied
+// literal is checked on both watches since on-the-fly strengthening
+// may have turned the clause into a reason of its other watch, and
+// a conflicting one survives as chronological analysis reuses it
+void Solver::removeGaussReasons()
+{
+	const LIT_ST* values = sp->value;
+	const C_REF* sources = sp->source;
+	C_REF* i = gauss.reasons, * j = i, * end = gauss.reasons.end();
+	while (i != end) {
+		const C_REF ref = *i++;
+		if (cm.deleted(ref)) continue;
+		CLAUSE& c = cm[ref];
+		const uint32 x = c[0], y = c[1];
+		if (ref == conflict
+			|| (values[x] > 0 && sources[ABS(x)] == ref)
+			|| (values[y] > 0 && sources[ABS(y)] == ref)) {
+			*j++ = ref;
+			continue;
+		}
+		removeClause(c, ref);
+	}
+	gauss.reasons.shrink(uint32(end - j));
+}
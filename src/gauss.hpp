@@ -0,0 +1,124 @@
+/***********************************************************************[gauss.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __GAUSS_
+#define __GAUSS_
+
+#include "solvetypes.hpp"
+
+namespace SeqFROST {
+
+	#define GAUSS_NOCOL UINT32_MAX
+	#define GAUSS_NOROW UINT32_MAX
+
+	#define GAUSS_WORD(COL) ((COL) >> 6)
+	#define GAUSS_BIT(COL)  (1ULL << ((COL) & 63))
+
+#if defined(__linux__) || defined(__CYGWIN__)
+	#define GAUSS_CTZ(X) __builtin_ctzll(X)
+#elif defined(_WIN32)
+	#define GAUSS_CTZ(X) _tzcnt_u64(X)
+#endif
+
+	// iterate over the set columns of a bit-packed row
+	#define forall_gauss_row(ROW, NWORDS, COL) \
+		for (uint32 W = 0, COL = 0; W < (NWORDS); ++W) \
+			for (uint64 BITS = (ROW)[W]; BITS && ((COL = (W << 6) + GAUSS_CTZ(BITS)), true); BITS &= BITS - 1)
+
+	// XOR candidate clause with sorted literals in a flat buffer
+	struct XCAND {
+		uint32 pos, size;
+	};
+
+	struct XCAND_CMP {
+		const uint32* lits;
+		XCAND_CMP(const uint32* _lits) : lits(_lits) {}
+		inline bool operator () (const XCAND& a, const XCAND& b) const {
+			if (a.size != b.size) return a.size < b.size;
+			const uint32* x = lits + a.pos, * y = lits + b.pos;
+			for (uint32 k = 0; k < a.size; ++k) {
+				const uint32 xv = ABS(x[k]), yv = ABS(y[k]);
+				if (xv != yv) return xv < yv;
+			}
+			return a.pos < b.pos;
+		}
+	};
+
+	/*****************************************************/
+	/*  Usage: Gauss-Jordan matrix of XOR constraints    */
+	/*         over bit-packed rows; every row has a     */
+	/*         basic column (in no other row) and one    */
+	/*         watched non-basic column                  */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+
+	struct GAUSS {
+		Vec<uint64> rows;
+		Vec<LIT_ST> rhs;
+		uVec1D basic, watch;
+		uVec1D colvar, colrow, varcol;
+		Vec<uVec1D> watchers;
+		Vec<C_REF> reasons;
+		Vec<uint64> stamps;
+		uVec1D modified;
+		Lits_t clause;
+		uint64 stamp;
+		uint32 nrows, ncols, nwords;
+		uint32 propagated;
+
+		GAUSS() :
+			stamp(0)
+			, nrows(0)
+			, ncols(0)
+			, nwords(0)
+			, propagated(0)
+		{ }
+
+		inline uint64*	row			(const uint32& r) { assert(r < nrows); return rows.data() + size_t(r) * nwords; }
+		inline bool		has			(const uint64* row, const uint32& col) const { assert(col < ncols); return row[GAUSS_WORD(col)] & GAUSS_BIT(col); }
+		inline void		toggle		(uint64* row, const uint32& col) { assert(col < ncols); row[GAUSS_WORD(col)] ^= GAUSS_BIT(col); }
+		inline void		addRow		(const uint32& dest, const uint32& src) {
+			uint64* d = row(dest);
+			const uint64* s = row(src);
+			for (uint32 w = 0; w < nwords; ++w) d[w] ^= s[w];
+			rhs[dest] ^= rhs[src];
+		}
+		inline void		swapRows	(const uint32& a, const uint32& b) {
+			uint64* x = row(a), * y = row(b);
+			for (uint32 w = 0; w < nwords; ++w) std::swap(x[w], y[w]);
+			std::swap(rhs[a], rhs[b]);
+		}
+		inline void		setWatch	(const uint32& r, const uint32& col) {
+			if (watch[r] == col) return;
+			watch[r] = col;
+			watchers[col].push(r);
+		}
+		inline void		destroy		() {
+			rows.clear(true), rhs.clear(true);
+			basic.clear(true), watch.clear(true);
+			colvar.clear(true), colrow.clear(true), varcol.clear(true);
+			watchers.clear(true), stamps.clear(true);
+			reasons.clear(true);
+			modified.clear(true), clause.clear(true);
+			nrows = ncols = nwords = propagated = 0;
+		}
+	};
+
+}
+
+#endif
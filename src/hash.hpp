@@ -0,0 +1,143 @@
+/***********************************************************************[hash.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __HASH_
+#define __HASH_
+
+#include "vector.hpp"
+#include "definitions.hpp"
+
+namespace SeqFROST {
+
+	/*****************************************************/
+	/*  Usage:   hash table of clause fingerprints       */
+	/*  Dependency:  vector, uint64, C_REF               */
+	/*****************************************************/
+
+	#define HASH_MUL	0x9E3779B97F4A7C15ULL
+	#define HASH_EMPTY	0ULL
+
+	// literal scrambler (splitmix64 finalizer)
+	inline uint64 hashLit(const uint32& lit) 
+	{
+		uint64 x = (uint64(lit) + 1) * HASH_MUL;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+		return x ^ (x >> 31);
+	}
+
+	// order-independent fingerprint, so lits need not be sorted
+	inline uint64 fingerprint(const uint32* lits, const int& size) 
+	{
+		uint64 key = uint64(size) * HASH_MUL;
+		for (int i = 0; i < size; ++i)
+			key += hashLit(lits[i]);
+		return key == HASH_EMPTY ? 1 : key;
+	}
+
+	struct HENTRY {
+		uint64 key;
+		C_REF ref;
+	};
+
+	class CHASH {
+
+		Vec<HENTRY> table;
+		uint32 mask, count;
+
+		inline void place(const uint64& key, const C_REF& ref) {
+			uint32 i = uint32(key) & mask;
+			while (table[i].key != HASH_EMPTY) i = (i + 1) & mask;
+			table[i].key = key, table[i].ref = ref;
+		}
+
+		inline void grow() {
+			Vec<HENTRY> old;
+			table.migrateTo(old);
+			const uint32 cap = old.size() << 1;
+			table.resize(cap);
+			std::memset(table.data(), 0, cap * sizeof(HENTRY));
+			mask = cap - 1;
+			forall_vector(HENTRY, old, e) {
+				if (e->key != HASH_EMPTY) 
+					place(e->key, e->ref);
+			}
+		}
+
+	public:
+
+		CHASH() : mask(0), count(0) { }
+
+		inline uint32 size() const { return count; }
+		inline bool empty() const { return !count; }
+
+		inline void reserve(const uint32& n) {
+			uint32 cap = 16;
+			while (cap < (n << 1)) cap <<= 1;
+			table.resize(cap);
+			std::memset(table.data(), 0, cap * sizeof(HENTRY));
+			mask = cap - 1, count = 0;
+		}
+
+		inline void insert(const uint64& key, const C_REF& ref) {
+			assert(key != HASH_EMPTY);
+			if (table.empty()) reserve(8);
+			else if (((count + 1) << 1) > table.size()) grow();
+			place(key, ref);
+			count++;
+		}
+
+		// map a unique 'key' to 'ref', replacing its previous entry
+		inline void assign(const uint64& key, const C_REF& ref) {
+			assert(key != HASH_EMPTY);
+			if (!table.empty()) {
+				uint32 i = uint32(key) & mask;
+				uint64 curr;
+				while ((curr = table[i].key) != HASH_EMPTY) {
+					if (curr == key) { table[i].ref = ref; return; }
+					i = (i + 1) & mask;
+				}
+			}
+			insert(key, ref);
+		}
+
+		// return the first entry with 'key' accepted by 'check'
+		template <class CHECK>
+		inline C_REF find(const uint64& key, CHECK check) const {
+			if (table.empty()) return UNDEF_REF;
+			uint32 i = uint32(key) & mask;
+			uint64 curr;
+			while ((curr = table[i].key) != HASH_EMPTY) {
+				if (curr == key && check(table[i].ref)) 
+					return table[i].ref;
+				i = (i + 1) & mask;
+			}
+			return UNDEF_REF;
+		}
+
+		inline void clear(const bool& _free = false) {
+			if (_free) table.clear(true), mask = 0;
+			else if (table.size()) std::memset(table.data(), 0, table.size() * sizeof(HENTRY));
+			count = 0;
+		}
+
+	};
+
+}
+
+#endif
@@ -80,19 +80,3 @@ void Solver::histCNF(BCNF& cnf, const bool& reset)
 		count_occurs(c, occs);
 	}
 }
-
-void Solver::histCNF(SCNF& cnf, const bool& reset) 
-{
-	if (cnf.empty()) return;
-
-	OCCUR* occs = occurs.data();
-
-	if (reset) 
-		memset(occs, 0, occurs.size() * sizeof(OCCUR));
-
-	forall_sclauses(scnf, i) {
-		SCLAUSE& c = scnf[*i];
-		if (c.deleted()) continue;
-		count_occurs(c, occs);
-	}
-}
\ No newline at end of file
@@ -63,6 +63,16 @@ namespace SeqFROST {
 			return a < b;
 		}
 	};
+	struct ELIM_CMP {
+		const uVec1D& costs;
+		ELIM_CMP(const uVec1D& _costs) : costs(_costs) {}
+		inline bool operator () (const uint32& a, const uint32& b) const {
+			const uint32 x = costs[a], y = costs[b];
+			if (x > y) return true;
+			if (x < y) return false;
+			return a > b;
+		}
+	};
 	struct MCV_CMP {
 		const uint32* scores;
 		MCV_CMP(const uint32* _scores) : scores(_scores) {}
@@ -32,37 +32,86 @@ bool Solver::LCVE()
 	LOGN2(2, " Finding eligible variables for LCVE..");
 
 	if (opts.profile_simplifier) timer.pstart();
-	eligible.resize(inf.maxVar);
-	occurs.resize(inf.maxVar + 1);
-	histCNF(scnf, true);
-	write_scores(vars, scores, occs);
-	wolfsort(vars, inf.maxVar, STABLE_LCV(scores));
+	syncOT();
+	assert(checkOccurs(ot, occurs.data(), sp->state, inf.maxVar));
+	scheduleVE();
 	if (opts.profile_simplifier) timer.pstop(), timer.vo += timer.pcpuTime();
 
 	LOGDONE(2, 5);
 
 	if (verbose > 3) {
 		LOG0(" Eligible variables:");
-		for (uint32 i = 0; i < eligible.size(); ++i) {
-			uint32 v = eligible[i];
-			LOG1("  e[%d]->(v: %d, p: %d, n: %d, s: %d)", i, v, occs[v].ps, occs[v].ns, scores[v]);
+		OCCUR* occs = occurs.data();
+		for (uint32 i = 0; i < eschedule.size(); ++i) {
+			uint32 v = eschedule[i];
+			LOG1("  e[%d]->(v: %d, p: %d, n: %d, s: %d)", i, v, occs[v].ps, occs[v].ns, elimcosts[v]);
 		}
 	}
 
 	// extended LCVE
+	electVE();
+
+	if (elected.size() < opts.lcve_min_vars) {
+		if (verbose > 1) LOGWARN("elected variables not enough");
+		return false;
+	}
+
+	return true;
+}
+
+// candidates are kept in a heap popped in ascending order of their 
+// elimination costs (ties broken by the smaller variable), which is
+// the order of a stable sort but can be updated within a phase
+inline void Solver::scheduleVE()
+{
+	OCCUR* occs = occurs.data();
+	const State_t* states = sp->state;
+	elimcosts.resize(inf.maxVar + 1, 0);
+	eschedule.clear();
+	eschedule.reserve(inf.maxVar);
+	forall_variables(v) {
+		elimcosts[v] = hist_score(v, occs);
+		if (iassumed(v) || states[v].state) continue;
+		if (!occs[v].ps && !occs[v].ns) continue;
+		eschedule.insert(v);
+	}
+}
+
+// a variable whose lists changed is moved in the schedule, or is
+// scheduled again if it got cheaper since it was last elected
+void Solver::rescheduleVE(const uint32& v)
+{
+	CHECKVAR(v);
+	if (v >= elimcosts.size() || sp->state[v].state) return;
+	const uint32 oldcost = elimcosts[v];
+	const uint32 cost = hist_score(v, occurs.data());
+	if (eschedule.has(v)) {
+		elimcosts[v] = cost;
+		eschedule.update(v, -double(oldcost), -double(cost));
+	}
+	else if (cost < oldcost) {
+		elimcosts[v] = cost;
+		eschedule.insert(v);
+	}
+}
+
+void Solver::electVE()
+{
 	LOGN2(2, " Electing variables in phase-%d..", phase);
 
 	sp->stacktail = sp->tmpstack;
 	uint32*& tail = sp->stacktail;
 	LIT_ST* frozen = sp->frozen;
+	OCCUR* occs = occurs.data();
 	const uint32 maxoccurs = opts.lcve_max_occurs;
 	const uint32 pmax = opts.mu_pos << multiplier;
 	const uint32 nmax = opts.mu_neg << multiplier;
 	const State_t* states = sp->state;
-	const uint32* end = eligible.end();
+	// popped candidates that may be elected in a later round
+	uVec1D postponed;
 	elected.clear();
-	while (vars != end) {
-		const uint32 cand = *vars++;
+	while (!eschedule.empty()) {
+		const uint32 cand = eschedule.pop();
 		CHECKVAR(cand);
 		if (iassumed(cand)) continue;
 		if (states[cand].state) continue;
@@ -71,14 +120,18 @@ bool Solver::LCVE()
 		assert((uint32)ot[p].size() >= occs[cand].ps);
 		assert((uint32)ot[n].size() >= occs[cand].ns);
 		if (!occs[cand].ps && !occs[cand].ns) continue;
-		if (occs[cand].ps > maxoccurs || occs[cand].ns > maxoccurs) break;
+		if (occs[cand].ps > maxoccurs || occs[cand].ns > maxoccurs) { postponed.push(cand); break; }
 		OL& poss = ot[p], &negs = ot[n];
 		const uint32 ps = (uint32)poss.size(), ns = (uint32)negs.size();
-		if (ps >= pmax && ns >= nmax) break;
+		if (ps >= pmax && ns >= nmax) { postponed.push(cand); break; }
+		if (!vtouched[cand]) continue;
 		if (depFreeze(poss, occs, frozen, tail, cand, pmax, nmax) &&
 			depFreeze(negs, occs, frozen, tail, cand, pmax, nmax))
 			elected.push(cand);
 	}
+	forall_vector(uint32, postponed, i) {
+		eschedule.insert(*i);
+	}
 
 	assert(_verifyelected(elected, sp->frozen));
 
@@ -109,15 +162,51 @@ bool Solver::LCVE()
 		LOGN0(" PLCVs ");
 		printVars(elected, elected.size(), 'v'); 
 	}
+}
 
-	if (elected.size() < opts.lcve_min_vars) {
-		if (verbose > 1) LOGWARN("elected variables not enough");
-		return false;
+// eliminations of the last round lowered the costs of neighbouring
+// variables, which are elected again within the same phase
+bool Solver::reelectVE(uVec1D& survivors)
+{
+	if (!opts.ve_en) return false;
+	if (INTERRUPTED) killSolver();
+	forall_vector(uint32, elected, i) {
+		if (*i) survivors.push(*i);
 	}
-
+	updateOT();
+	if (!prop()) killSolver();
+	syncOT();
+	if (eschedule.empty()) return false;
+	electVE();
+	if (elected.empty()) return false;
+	stats.simplify.rounds++;
+	sortOT();
 	return true;
 }
 
+// BCE of this phase covers the survivors of all rounds
+void Solver::keepElected(uVec1D& survivors)
+{
+	eschedule.clear();
+	if (survivors.empty()) return;
+	const State_t* states = sp->state;
+	LIT_ST* marks = sp->frozen;
+	forall_vector(uint32, elected, i) {
+		if (*i) marks[*i] = 1;
+	}
+	forall_vector(uint32, survivors, i) {
+		const uint32 v = *i;
+		if (marks[v] || states[v].state) continue;
+		marks[v] = 1;
+		elected.push(v);
+	}
+	forall_vector(uint32, elected, i) {
+		if (*i) marks[*i] = 0;
+	}
+	// resolvents of later rounds may contain earlier survivors
+	indexOT();
+}
+
 inline bool Solver::depFreeze(OL& ol, OCCUR* occs, LIT_ST* frozen, uint32*& tail, const uint32& cand, const uint32& pmax, const uint32& nmax)
 {
 	const int maxcsize = opts.lcve_clause_max;
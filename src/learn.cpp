@@ -64,21 +64,77 @@ inline uint32 Solver::where()
 	return jmplevel;
 }
 
+// a duplicate can replace the learnt clause only if it is watched 
+// by the same two literals, i.e. the asserting literal and the 
+// highest-level one, otherwise it has to be replaced by the learnt
+inline bool Solver::reuseDuplicate(const C_REF& dref)
+{
+	CLAUSE& d = cm[dref];
+	const uint32 first = learntC[0], second = learntC[1];
+	if ((d[0] != first || d[1] != second) && (d[0] != second || d[1] != first)) 
+		return false;
+	d[0] = first, d[1] = second;
+	if (d.learnt()) {
+		const int size = d.size();
+		const int lbd = sp->learntLBD > size ? size : sp->learntLBD;
+		if (lbd < d.lbd()) {
+			d.set_lbd(lbd);
+			if (size > 2 && lbd <= opts.lbd_tier1) d.set_keep(true);
+		}
+		if (d.usage() < USAGET3 + (lbd <= opts.lbd_tier2)) 
+			d.set_usage(USAGET3 + (lbd <= opts.lbd_tier2));
+	}
+	LOGCLAUSE(4, d, "  reusing duplicate");
+	stats.duplicates.reused++;
+	return true;
+}
+
 C_REF Solver::learn()
 {
 	assert(trail.size());
 
 	const uint32 jmplevel = where();
 
+#ifdef STATISTICS
+	const uint64 bttime = nanotime();
+	backtrack(jmplevel);
+	stats.analysis.backtracking = nanotime() - bttime;
+	stats.analysis.backtrack.add(stats.analysis.backtracking);
+#else
 	backtrack(jmplevel);
+#endif
 
 	if (learntC.size() == 1) {
 		enqueueUnit(learntC[0]);
 		stats.units.learnt++;
 	}
 	else {
+		bool learnt = true;
+		uint64 key = 0;
+		C_REF dref = UNDEF_REF;
+		if (opts.hashdup_en) {
+			key = fingerprint(learntC, learntC.size());
+			dref = findDuplicate(learntC, learntC.size(), key);
+			if (REASON(dref)) {
+				stats.duplicates.learnt++;
+				if (reuseDuplicate(dref)) {
+					enqueue(*learntC, jmplevel, dref);
+					return UNDEF_REF;
+				}
+				learnt = cm[dref].learnt(); // inherit the duplicate type
+			}
+		}
 		if (opts.proof_en) proof.addClause(learntC);
-		C_REF r = addClause(learntC, true);
+		C_REF r = addClause(learntC, learnt);
+		if (opts.hashdup_en) {
+			CLAUSE& c = cm[r];
+			if (hashable(c)) chash.insert(key, r);
+			if (REASON(dref)) {
+				CLAUSE& d = cm[dref];
+				LOGCLAUSE(4, d, "  removing stale duplicate");
+				removeClause(d, dref);
+			}
+		}
 		enqueue(*learntC, jmplevel, r);
 		return r;
 	}
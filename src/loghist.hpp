@@ -0,0 +1,86 @@
+/***********************************************************************[loghist.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __LOGHIST_
+#define __LOGHIST_
+
+#include "definitions.hpp"
+
+namespace SeqFROST {
+
+	/*****************************************************/
+	/*  Usage:   log2-scale histogram of uint64 samples  */
+	/*  Dependency:  uint64                              */
+	/*****************************************************/
+
+	// bin 0 for zero and bin 'k' for [2^(k-1), 2^k)
+	constexpr int LOGHIST_BINS = 65;
+
+	struct LOGHIST {
+		uint64 bins[LOGHIST_BINS];
+		uint64 sum;
+
+		inline void add(const uint64& x) {
+			int bin = 0;
+			for (uint64 y = x; y; y >>= 1) bin++;
+			bins[bin]++;
+			sum += x;
+		}
+
+		inline uint64 samples() const {
+			uint64 total = 0;
+			for (int b = 0; b < LOGHIST_BINS; ++b) total += bins[b];
+			return total;
+		}
+
+		inline void range(char* str, const int& b) const {
+			if (!b) { snprintf(str, 48, "0"); return; }
+			const uint64 lo = 1ULL << (b - 1), hi = lo + (lo - 1);
+			if (lo == hi) snprintf(str, 48, "%llu", (unsigned long long)lo);
+			else snprintf(str, 48, "%llu-%llu", (unsigned long long)lo, (unsigned long long)hi);
+		}
+
+		inline void report(const char* name) const {
+			const uint64 total = samples();
+			LOG1(" %s%-25s : %s%-16lld (avg: %.2f)%s", CREPORT, name, CREPORTVAL, 
+				total, ratio(double(sum), double(total)), CNORMAL);
+			if (!total) return;
+			char str[48];
+			for (int b = 0; b < LOGHIST_BINS; ++b) {
+				const uint64 count = bins[b];
+				if (!count) continue;
+				range(str, b);
+				LOG1(" %s  %-21s   : %s%-16lld (%5.2f %%)%s", CREPORT, str, CREPORTVAL,
+					count, percent(double(count), double(total)), CNORMAL);
+			}
+		}
+
+		// rows of 'name,range,count' for non-empty bins
+		inline void write(FILE* file, const char* name) const {
+			char str[48];
+			for (int b = 0; b < LOGHIST_BINS; ++b) {
+				if (!bins[b]) continue;
+				range(str, b);
+				fprintf(file, "%s,%s,%llu\n", name, str, (unsigned long long)bins[b]);
+			}
+		}
+	};
+
+}
+
+#endif
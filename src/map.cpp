@@ -28,6 +28,7 @@ void Solver::map(const bool& sigmified)
 	assert(!LEVEL);
 	assert(trail.size() == sp->propagated);
 	stats.mapping.calls++;
+	gauss.destroy();
 	vmap.initiate(sp);
 	// map model literals
 	vmap.mapOrgs(model.lits);
@@ -39,6 +40,9 @@ void Solver::map(const bool& sigmified)
 		vmap.mapShrinkVars(ifrozen);
 	// map transitive start literal
 	vmap.mapTransitive(last.transitive.literals);
+	// map at-most-one constraints
+	shrinkCards();
+	vmap.mapOrgs(cards.lits);
 	// map clauses and watch tables
 	if (!sigmified) {
 		vmap.mapClauses(cm, orgs);
@@ -57,6 +61,11 @@ void Solver::map(const bool& sigmified)
 	// - VMTF
 	vmtf.map(*vmap, firstFrozen, vmap.size());
 	vmap.mapShrinkVars(bumps);
+	// - touched variables
+	vmap.mapShrinkVars(vtouched);
+	ntouched = 0;
+	for (uint32 v = 1; v <= vmap.numVars(); ++v)
+		ntouched += vtouched[v];
 	// - VSIDS
 	uVec1D tmp;
 	while (vsidsheap.size()) {
@@ -86,7 +95,10 @@ void Solver::map(const bool& sigmified)
 	elected.reserve(vmap.numVars());
 	occurs.clear(true);
 	dlevel.clear(true);
+	savedtrail.clear(true);
+	savedpos = 0;
 	dlevel.reserve(vmap.numVars());
+	trail.reserve(vmap.numVars());
 	dlevel.push(level_t());
 	// map search space
 	SP* newSP = new SP(vmap.size(), opts.polarity);
@@ -112,6 +124,7 @@ void Solver::map(const bool& sigmified)
 
 	inf.maxVar = vmap.numVars();
 	inf.nDualVars = V2L(inf.maxVar + 1);
+	cards.attach(inf.nDualVars);
 	inf.maxFrozen = inf.maxMelted = inf.maxSubstituted = 0;
 	vmap.destroy();
 	printStats(1, 'a', CGREEN2);
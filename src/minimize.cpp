@@ -20,33 +20,67 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace SeqFROST;
 
-bool Solver::minimize(const uint32& lit, const int& depth)
+#define MIN_KEEP	0
+#define MIN_GONE	1
+#define MIN_EXPAND	2
+
+// decide 'lit' from the cached marks if possible,
+// otherwise its reason has to be expanded
+inline int Solver::minimizeLit(const uint32& lit, const int& depth)
 {
 	CHECKLIT(lit);
-	if (depth >= opts.minimize_depth) return false;
+	if (depth >= opts.minimize_depth) return MIN_KEEP;
 	const uint32 v = ABS(lit);
 	const uint32 litlevel = sp->level[v];
-	LIT_ST* seen = sp->seen;
-	if (!litlevel || (REMOVABLE(seen[v]) && depth)) return true;
+	const LIT_ST seen = sp->seen[v];
+	if (!litlevel || (REMOVABLE(seen) && depth)) return MIN_GONE;
 	const C_REF r = sp->source[v];
-	if (DECISION(r) || POISONED(seen[v])) return false;
-	if (sp->state[litlevel].dlcount < MAX_DLC) return false;
+	if (DECISION(r) || POISONED(seen)) return MIN_KEEP;
+	if (sp->state[litlevel].dlcount < MAX_DLC) return MIN_KEEP;
 	assert(REASON(r));
-	CLAUSE& c = cm[r];
 	if (opts.minimizeall_en) stats.searchticks++;
-	LOGCLAUSE(4, c, "  checking %d reason", -l2i(lit));
+	LOG2(4, "  checking %d reason (ref %zd)", -l2i(lit), r);
+	return MIN_EXPAND;
+}
+
+// explicit-stack depth-first search over reasons where every
+// expanded variable (except the root) is cached as removable 
+// or poisoned in 'seen' until 'clearMinimized' is called
+bool Solver::minimize(const uint32& lit, const int& depth)
+{
+	const int first = minimizeLit(lit, depth);
+	if (first != MIN_EXPAND) return first == MIN_GONE;
+	LIT_ST* seen = sp->seen;
+	const C_REF* sources = sp->source;
+	assert(minstack.empty());
+	minstack.push(MINFRAME(lit));
 	bool gone = true;
-	uint32* cend = c.end();
-	for (uint32* k = c; gone && k != cend; ++k) {
-		const uint32 other = *k;
-		if (NEQUAL(other, lit))
-			gone = minimize(FLIP(other), depth + 1);
+	while (minstack.size()) {
+		MINFRAME& frame = minstack.back();
+		const uint32 parent = frame.lit;
+		const uint32 v = ABS(parent);
+		const int currdepth = depth + int(minstack.size()) - 1;
+		if (gone) {
+			CLAUSE& c = explain(sources[v], parent);
+			const int size = c.size();
+			bool expand = false;
+			while (frame.idx < size) {
+				const uint32 other = c[frame.idx++];
+				if (other == parent) continue;
+				const uint32 child = FLIP(other);
+				const int res = minimizeLit(child, currdepth + 1);
+				if (res == MIN_KEEP) { gone = false; break; }
+				if (res == MIN_EXPAND) { expand = true; minstack.push(MINFRAME(child)); break; }
+			}
+			if (expand) continue;
+		}
+		if (currdepth)
+			seen[v] = gone ? REMOVABLE_M : POISONED_M;
+		else 
+			assert(REMOVABLE(seen[v]));
+		minimized.push(v);
+		minstack.pop();
 	}
-	if (depth) 
-		seen[v] = gone ? REMOVABLE_M : POISONED_M;
-	else 
-		assert(REMOVABLE(seen[v]));
-	minimized.push(v);
 	return gone;
 }
 
@@ -85,7 +85,7 @@ inline uint32 Solver::analyzeReason(bool& failed, const uint32& level, const uin
 	assert(sp->level[uipvar] == level);
 	const C_REF ref = sp->source[uipvar];
 	assert(REASON(ref));
-	CLAUSE& c = cm[ref];
+	CLAUSE& c = explain(ref, uip);
 	LOGCLAUSE(4, c, "  checking %d reason", l2i(uip));
 	stats.searchticks++;
 	uint32 bsize = 0;
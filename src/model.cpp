@@ -100,9 +100,11 @@ void MODEL::extend(LIT_ST* currValue)
 	assert(orgvalues == NULL);
 	orgvalues = currValue;
     uint32 updated = 0;
-    value.resize(maxVar + 1, 0);
+	// variables added by BVA are mapped beyond 'maxVar'
+	const uint32 nvars = lits.size();
+    value.resize(nvars, 0);
 	LIT_ST* newvalues = value.data();
-    for (uint32 v = 1; v <= maxVar; ++v) {
+    for (uint32 v = 1; v < nvars; ++v) {
         const uint32 mlit = lits[v];
         if (mlit && !UNASSIGNED(orgvalues[mlit])) {
 			newvalues[v] = orgvalues[mlit];
@@ -32,21 +32,43 @@ BOOL_OPT opt_ve_en("bounded", "enable bounded variable elimination (BVE)", true)
 BOOL_OPT opt_ve_lbound_en("bvebound", "skip variables resulting in more literals than original", false);
 BOOL_OPT opt_ve_fun_en("function", "enable function table reasoning", true);
 BOOL_OPT opt_ve_plus_en("boundedextend", "enable subsumption elimination before variable elimination", true);
+BOOL_OPT opt_bva_en("bva", "enable bounded variable addition (BVA)", false);
+BOOL_OPT opt_amo_en("amo", "enable extraction of pairwise-encoded at-most-one constraints propagated natively in search", false);
 
 INT_OPT opt_lcve_min_vars("electionsmin", "minimum elected variables to simplify", 1, INT32R(1, INT32_MAX));
 INT_OPT opt_lcve_max_occurs("electionsmax", "maximum occurrence list size to check in elections (LCVE)", 3e3, INT32R(1, INT32_MAX));
 INT_OPT opt_lcve_clause_max("electionsclausemax", "maximum clause size to check in LCVE", 3e4, INT32R(1, INT32_MAX));
 INT_OPT opt_bce_max_occurs("blockedmaxoccurs", "maximum occurrence list size to scan in BCE", 1e3, INT32R(100, INT32_MAX));
+INT_OPT opt_bva_max_occurs("bvamaxoccurs", "maximum occurrence list size to scan in BVA", 1e3, INT32R(100, INT32_MAX));
+INT_OPT opt_bva_clause_max("bvaclausemax", "maximum clause size to match in BVA", 100, INT32R(2, INT32_MAX));
+INT_OPT opt_bva_effort("bvaeffort", "maximum literals (in millions) visited by BVA per simplification", 20, INT32R(1, INT32_MAX));
+INT_OPT opt_amo_min_size("amominsize", "minimum size of an extracted at-most-one constraint", 4, INT32R(3, INT32_MAX));
+INT_OPT opt_amo_effort("amoeffort", "maximum literals (in millions) visited by at-most-one extraction per simplification", 20, INT32R(1, INT32_MAX));
 INT_OPT opt_collect_freq("collectfrequency", "set the frequency of CNF memory shrinkage in the simplifier", 2, INT32R(0, 5));
 INT_OPT opt_ere_extend("redundancyextend", "extend ERE with clause strengthening (0: no extend, 1: originals, 2: all)", 1, INT32R(0, 3));
 INT_OPT opt_ere_max_occurs("redundancymaxoccurs", "maximum occurrence list size to scan in ERE", 1e3, INT32R(100, INT32_MAX));
 INT_OPT opt_ere_clause_max("redundancyclausemax", "maximum resolvent size for forward check in ERE", 200, INT32R(2, INT32_MAX));
+INT_OPT opt_ere_hash_min("redundancyhashmin", "minimum shortest list size to look up resolvents by hash in ERE", 64, INT32R(0, INT32_MAX));
 INT_OPT opt_sub_max_occurs("subsumemaxoccurs", "maximum occurrence list size to scan in SUB", 1e3, INT32R(100, INT32_MAX));
 INT_OPT opt_sub_clause_max("subsumeclausemax", "maximum clause size to check in SUB", 100, INT32R(0, INT32_MAX));
 INT_OPT opt_mu_pos("mupos", "set the positive occurrences limit in LCVE", 32, INT32R(10, INT32_MAX));
 INT_OPT opt_mu_neg("muneg", "set the negative occurrences limit in LCVE", 32, INT32R(10, INT32_MAX));
 INT_OPT opt_phases("phases", "set the number of phases in to run simplifications", 5, INT32R(0, INT32_MAX));
 INT_OPT opt_lits_phase_min("eliminationphasemin", "minimum removed literals per phase to stop simplifications", 500, INT32R(1, INT32_MAX));
+INT_OPT opt_simp_threads("simpthreads", "number of threads used by parallel simplifications (0: all hardware threads)", 1, INT32R(0, 1024));
+INT_OPT opt_ve_max_eff("boundedmaxeff", "maximum BVE efficiency", 1e2, INT32R(0, INT32_MAX));
+INT_OPT opt_ve_min_eff("boundedmineff", "minimum BVE efficiency", 3e7, INT32R(0, INT32_MAX));
+INT_OPT opt_ve_rel_eff("boundedreleff", "relative BVE efficiency per mille", 1e3, INT32R(0, INT32_MAX));
+INT_OPT opt_sub_max_eff("subsumemaxeff", "maximum SUB efficiency", 1e2, INT32R(0, INT32_MAX));
+INT_OPT opt_sub_min_eff("subsumemineff", "minimum SUB efficiency", 1e8, INT32R(0, INT32_MAX));
+INT_OPT opt_sub_rel_eff("subsumereleff", "relative SUB efficiency per mille", 1e3, INT32R(0, INT32_MAX));
+INT_OPT opt_bce_max_eff("blockedmaxeff", "maximum BCE efficiency", 1e2, INT32R(0, INT32_MAX));
+INT_OPT opt_bce_min_eff("blockedmineff", "minimum BCE efficiency", 1e8, INT32R(0, INT32_MAX));
+INT_OPT opt_bce_rel_eff("blockedreleff", "relative BCE efficiency per mille", 1e3, INT32R(0, INT32_MAX));
+INT_OPT opt_ere_max_eff("redundancymaxeff", "maximum ERE efficiency", 1e2, INT32R(0, INT32_MAX));
+INT_OPT opt_ere_min_eff("redundancymineff", "minimum ERE efficiency", 1e8, INT32R(0, INT32_MAX));
+INT_OPT opt_ere_rel_eff("redundancyreleff", "relative ERE efficiency per mille", 1e3, INT32R(0, INT32_MAX));
+INT_OPT opt_ve_rounds("boundedrounds", "maximum rounds of BVE per phase over re-elected variables", 2, INT32R(1, INT32_MAX));
 INT_OPT opt_ve_clause_max("boundedclausemax", "maximum resolvent size (0: no limit)", 100, INT32R(0, INT32_MAX));
 INT_OPT opt_xor_max_arity("xormaxarity", "maximum XOR fanin size", 10, INT32R(2, 20));
 
@@ -60,8 +82,12 @@ BOOL_OPT opt_debinary_en("debinary", "remove duplicated binaries", true);
 BOOL_OPT opt_decompose_en("decompose", "decompose binary implication gragh into SCCs", true);
 BOOL_OPT opt_time_quiet_en("timequiet", "report time even in quiet mode", false);
 BOOL_OPT opt_targetonly_en("targetonly", "use only target phase", false);
+BOOL_OPT opt_congruence_en("congruence", "enable congruence closure over AND/XOR/ITE gates in probing", false);
+BOOL_OPT opt_gauss_en("gauss", "enable Gauss-Jordan elimination on XOR constraints during search", true);
 BOOL_OPT opt_ternary_en("ternary", "enable hyper ternary resolution", true);
 BOOL_OPT opt_ternary_sleep_en("ternarysleep", "allow hyper ternary resolution to sleep", true);
+BOOL_OPT opt_hashdup_en("hashduplicates", "detect duplicated original and learnt clauses by hashing", true);
+BOOL_OPT opt_trailsave_en("trailsave", "save cancelled trail and restore its implications without watch scanning", false);
 BOOL_OPT opt_transitive_en("transitive", "enable transitive reduction on binary implication graph", true);
 BOOL_OPT opt_parseonly_en("parseonly", "parse only the input formula", false);
 BOOL_OPT opt_parseincr_en("parseincr", "parse input formula incrementally", false);
@@ -71,6 +97,7 @@ BOOL_OPT opt_proof_nonbinary_en("proofnonbinary", "generate proof in binary DRAT
 BOOL_OPT opt_probe_en("probe", "enable failed literal probing", true);
 BOOL_OPT opt_probe_sleep_en("probesleep", "allow failed literal probing to sleep", true);
 BOOL_OPT opt_probehbr_en("probehyper", "learn hyper binary clauses", true);
+BOOL_OPT opt_probe_tree_en("probetree", "probe along a binary implication forest reusing parent propagations", false);
 BOOL_OPT opt_model_en("model", "extend model with eliminated variables", false);
 BOOL_OPT opt_modelprint_en("modelprint", "print model on stdout", false);
 BOOL_OPT opt_modelverify_en("modelverify", "verify model on input formula", false);
@@ -97,6 +124,9 @@ INT_OPT	opt_decheuristic("decisionheuristic", "initial decision heap heuristic (
 INT_OPT opt_decompose_min("decomposemin", "minimum rounds to decompose", 2, INT32R(1, 10));
 INT_OPT opt_decompose_limit("decomposelimit", "decompose round limit", 1e7, INT32R(0, 10));
 INT_OPT opt_decompose_min_eff("decomposemineff", "decompose minimum efficiency", 1e7, INT32R(0, INT32_MAX));
+INT_OPT opt_congruence_max_arity("congruencemaxarity", "maximum gate size to extract for congruence closure", 6, INT32R(3, 6));
+INT_OPT opt_gauss_max_arity("gaussmaxarity", "maximum XOR size to extract for Gauss-Jordan elimination", 6, INT32R(3, 6));
+INT_OPT opt_gauss_max_rows("gaussmaxrows", "maximum XOR constraints in the Gauss-Jordan matrix", 1024, INT32R(1, INT32_MAX));
 INT_OPT opt_mdm_heappumps("mdmheappumps", "set the number of follow-up decision pumps using Heap score", 0, INT32R(0, 3));
 INT_OPT opt_mdm_vmtfpumps("mdmvmtfpumps", "set the number of follow-up decision pumps using VMFQ score", 1, INT32R(0, 3));
 INT_OPT opt_mdm_maxoccurs("mdmmaxoccurs", "maximum occurrence list size in MDM", 3e3, INT32R(1, INT32_MAX));
@@ -165,6 +195,8 @@ DOUBLE_OPT opt_var_inc("varinc", "VSIDS increment value", 1.0, FP64R(1, 10));
 DOUBLE_OPT opt_var_decay("vardecay", "VSIDS decay value", 0.95, FP64R(0, 1));
 DOUBLE_OPT opt_garbage_perc("collect", "collect garbage if its percentage exceeds this value", 0.25, FP64R(0, 1));
 STRING_OPT opt_proof_out("proofout", "output file to write binary proof", "proof.out");
+STRING_OPT opt_analysis_out("analysisout", "output file to write conflict analysis histograms (CSV) if statistics are enabled", "");
+STRING_OPT opt_profile_out("profileout", "output file to write per-literal propagation profile (CSV)", "profile.csv");
 
 #if defined(__linux__) || defined(__CYGWIN__)
 #pragma GCC diagnostic push
@@ -176,6 +208,8 @@ OPTION::OPTION()
 	RESETSTRUCT(this);
 	int MAXLEN = 256;
 	proof_path = sfcalloc<char>(MAXLEN);
+	profile_path = sfcalloc<char>(MAXLEN);
+	analysis_path = sfcalloc<char>(MAXLEN);
 }
 
 #if defined(__linux__) || defined(__CYGWIN__)
@@ -188,6 +222,14 @@ OPTION::~OPTION()
 		std::free(proof_path);
 		proof_path = NULL;
 	}
+	if (profile_path != NULL) {
+		std::free(profile_path);
+		profile_path = NULL;
+	}
+	if (analysis_path != NULL) {
+		std::free(analysis_path);
+		analysis_path = NULL;
+	}
 }
 
 void OPTION::init() 
@@ -208,6 +250,9 @@ void OPTION::init()
 	decompose_min		= opt_decompose_min;
 	decompose_limit		= opt_decompose_limit;
 	decompose_min_eff	= opt_decompose_min_eff;
+	congruence_max_arity = opt_congruence_max_arity;
+	gauss_max_arity		= opt_gauss_max_arity;
+	gauss_max_rows		= opt_gauss_max_rows;
 	mab_constant		= opt_mab_constant;
 	model_en			= opt_model_en;
 	modelprint_en		= opt_modelprint_en;
@@ -233,6 +278,8 @@ void OPTION::init()
 	map_perc			= opt_map_perc;
 	nap					= opt_nap;
 	memcpy(proof_path, opt_proof_out, opt_proof_out.length());
+	memcpy(profile_path, opt_profile_out, opt_profile_out.length());
+	memcpy(analysis_path, opt_analysis_out, opt_analysis_out.length());
 	parseonly_en		= opt_parseonly_en;
 	parseincr_en		= opt_parseincr_en;
 	proof_en			= opt_proof_en;
@@ -240,6 +287,7 @@ void OPTION::init()
 	probe_en			= opt_probe_en;
 	probe_sleep_en		= opt_probe_sleep_en;
 	probehbr_en			= opt_probehbr_en;
+	probe_tree_en		= opt_probe_tree_en;
 	probe_inc			= opt_probe_inc;
 	probe_min			= opt_probe_min;
 	probe_min_eff		= opt_probe_min_eff;
@@ -250,6 +298,8 @@ void OPTION::init()
 	time_quiet_en		= opt_time_quiet_en;
 	targetonly_en		= opt_targetonly_en;
 	ternary_en			= opt_ternary_en;
+	congruence_en		= opt_congruence_en;
+	gauss_en			= opt_gauss_en;
 	ternary_sleep_en	= opt_ternary_sleep_en;
 	ternary_priorbins	= opt_ternary_priorbins;
 	ternary_min_eff		= opt_ternary_min_eff;
@@ -257,6 +307,8 @@ void OPTION::init()
 	ternary_rel_eff		= opt_ternary_rel_eff;
 	ternary_perc		= opt_ternary_perc;
 	transitive_en		= opt_transitive_en;
+	trailsave_en		= opt_trailsave_en;
+	hashdup_en			= opt_hashdup_en;
 	transitive_min_eff  = opt_transitive_min_eff;
 	transitive_max_eff  = opt_transitive_max_eff;
 	transitive_rel_eff  = opt_transitive_rel_eff;
@@ -319,6 +371,19 @@ void OPTION::init()
 		ve_lbound_en		= opt_ve_lbound_en;
 		ve_fun_en			= opt_ve_fun_en;
 		ve_clause_max		= opt_ve_clause_max;
+		ve_rounds			= opt_ve_rounds;
+		ve_min_eff			= opt_ve_min_eff;
+		ve_max_eff			= opt_ve_max_eff;
+		ve_rel_eff			= opt_ve_rel_eff;
+		sub_min_eff			= opt_sub_min_eff;
+		sub_max_eff			= opt_sub_max_eff;
+		sub_rel_eff			= opt_sub_rel_eff;
+		bce_min_eff			= opt_bce_min_eff;
+		bce_max_eff			= opt_bce_max_eff;
+		bce_rel_eff			= opt_bce_rel_eff;
+		ere_min_eff			= opt_ere_min_eff;
+		ere_max_eff			= opt_ere_max_eff;
+		ere_rel_eff			= opt_ere_rel_eff;
 		xor_max_arity		= opt_xor_max_arity;
 		bce_en				= opt_bce_en;
 		bce_max_occurs		= opt_bce_max_occurs;
@@ -326,12 +391,21 @@ void OPTION::init()
 		ere_extend			= opt_ere_extend;
 		ere_max_occurs		= opt_ere_max_occurs;
 		ere_clause_max		= opt_ere_clause_max;
+		ere_hash_min		= opt_ere_hash_min;
+		bva_en				= opt_bva_en;
+		bva_max_occurs		= opt_bva_max_occurs;
+		bva_clause_max		= opt_bva_clause_max;
+		bva_effort			= opt_bva_effort;
+		amo_en				= opt_amo_en;
+		amo_min_size		= opt_amo_min_size;
+		amo_effort			= opt_amo_effort;
 		sub_en				= opt_sub_en;
 		sub_max_occurs		= opt_sub_max_occurs;
 		sub_clause_max		= opt_sub_clause_max;
 		lcve_min_vars		= opt_lcve_min_vars;
 		lcve_max_occurs		= opt_lcve_max_occurs;
 		lcve_clause_max		= opt_lcve_clause_max;
+		simp_threads		= opt_simp_threads;
 		phase_lits_min		= opt_lits_phase_min;
 		mu_pos				= opt_mu_pos;
 		mu_neg				= opt_mu_neg;
@@ -341,7 +415,7 @@ void OPTION::init()
 		profile_simplifier		= opt_profile_simp_en;
 		aggr_cnf_sort		= opt_aggr_cnf_sort;
 		if (all_en) 
-			ve_en = 1, ve_plus_en = 1, bce_en = 1, ere_en = 1;
+			ve_en = 1, ve_plus_en = 1, bce_en = 1, ere_en = 1, bva_en = 1;
 		if (!phases && (ve_en || sub_en || bce_en)) 
 			phases = 1; // at least 1 phase needed
 		if (phases && !(ve_en || sub_en || bce_en))
@@ -32,6 +32,8 @@ namespace SeqFROST {
 		LIT_ST	polarity;
 		//------------------------------------------//
 		char*	proof_path;
+		char*	profile_path;
+		char*	analysis_path;
 		//------------------------------------------//
 		int64	learntsub_max;
 		//------------------------------------------//
@@ -60,6 +62,8 @@ namespace SeqFROST {
 		int		rephase_inc;
 		int		decompose_min;
 		int		decompose_min_eff;
+		int		gauss_max_arity, gauss_max_rows;
+		int		congruence_max_arity;
 		int		simplify_priorbins;
 		int		minimize_depth;
 		int		minimize_min;
@@ -74,6 +78,10 @@ namespace SeqFROST {
 		int		transitive_min_eff, transitive_max_eff, transitive_rel_eff;
 		int		vivify_priorbins, vivify_min_eff, vivify_max_eff, vivify_rel_eff;
 		int		walk_priorbins, walk_min_eff, walk_max_eff, walk_rel_eff;
+		int		ve_min_eff, ve_max_eff, ve_rel_eff;
+		int		sub_min_eff, sub_max_eff, sub_rel_eff;
+		int		bce_min_eff, bce_max_eff, bce_rel_eff;
+		int		ere_min_eff, ere_max_eff, ere_rel_eff;
 		//------------------------------------------//
 		uint32  chrono_min;
 		uint32  forward_max_occs;
@@ -92,12 +100,16 @@ namespace SeqFROST {
 		bool	debinary_en;
 		bool	time_quiet_en;
 		bool	transitive_en;
+		bool	trailsave_en;
+		bool	hashdup_en;
 		bool	targetonly_en;
+		bool	gauss_en;
+		bool	congruence_en;
 		bool	ternary_en, ternary_sleep_en;
 		bool	autarky_en, autarky_sleep_en;
 		bool	proof_en, proof_nonbinary_en;
 		bool	parseonly_en, parseincr_en;
-		bool	probe_en, probehbr_en, probe_sleep_en;
+		bool	probe_en, probehbr_en, probe_sleep_en, probe_tree_en;
 		bool	model_en, modelprint_en, modelverify_en;
 		bool	minimize_en, minimizebin_en, minimizeall_en, minimizesort_en;
 		bool	mdm_walk_init_en, mdm_walk_en, mdm_mcv_en, mdmassume_en, mdmvsidsonly_en;
@@ -108,6 +120,8 @@ namespace SeqFROST {
 		bool	sub_en;
 		bool	bce_en;
 		bool	ere_en;
+		bool	bva_en;
+		bool	amo_en;
 		bool	all_en;
 		bool	solve_en;
 		bool	profile_simplifier;
@@ -120,12 +134,18 @@ namespace SeqFROST {
 		int		collect_freq;
 		int		xor_max_arity;
 		int		ve_clause_max;
+		int		ve_rounds;
 		int		sub_clause_max;
 		int		ere_clause_max;
+		int		ere_hash_min;
 		int		lcve_clause_max;
-		int		sub_max_occurs, bce_max_occurs, ere_max_occurs;
+		int		bva_clause_max;
+		int		sub_max_occurs, bce_max_occurs, ere_max_occurs, bva_max_occurs;
+		int		bva_effort;
+		int		amo_min_size, amo_effort;
 		//------------------------------------------//
 		uint32	lcve_min_vars, lcve_max_occurs;
+		uint32	simp_threads;
 		uint32	phase_lits_min;
 		uint32	mu_pos, mu_neg;
 		//------------------------------------------//
@@ -203,7 +203,7 @@ void Solver::printSource()
 		uint32 v = ABS(trail[i]);
 		C_REF r = sp->source[v];
 		if (REASON(r))
-			LOGCLAUSE(1, cm[r], " Source(v:%d, r:%zd)->", v, r);
+			LOGCLAUSE(1, explain(r, trail[i]), " Source(v:%d, r:%zd)->", v, r);
 	}
 }
 
@@ -36,8 +36,10 @@ void Solver::probe()
 #endif
 
 	probed = true;
+	clearSavedTrail();
 
 	decompose(true);
+	congruence();
 	ternary();  
 	debinary();
 	transitive();
@@ -47,6 +49,8 @@ void Solver::probe()
 
 	probed = false;
 
+	if (NOT_UNSAT) buildGauss();
+
 #ifdef LOGGING
 	const uint32 after = ACTIVEVARS;
 	const uint32 removed = before - after;
@@ -198,6 +198,8 @@ void PROOF::deleteClause(CLAUSE& c) { delline(c.data(), c.size()); }
 
 void PROOF::deleteClause(SCLAUSE& c) { delline(c.data(), c.size()); }
 
+void PROOF::deleteClause(const uint32* lits, const int& size) { delline(lits, size); }
+
 void PROOF::deleteClause(SCLAUSE& c, const uint32& def, const uint32& other)
 {
 	assert(clause.empty());
@@ -211,13 +213,15 @@ void PROOF::deleteClause(SCLAUSE& c, const uint32& def, const uint32& other)
 	deleteClause();
 }
 
-void PROOF::addResolvent(SCLAUSE& c)
+void PROOF::addResolvent(SCLAUSE& c) { addResolvent(c.data(), c.size()); }
+
+void PROOF::addResolvent(const uint32* lits, const int& size)
 {
 	assert(clause.empty());
 	assert(sp != NULL);
 	const LIT_ST* values = sp->value;
-	forall_clause(c, k) {
-		const uint32 lit = *k;
+	for (int k = 0; k < size; ++k) {
+		const uint32 lit = lits[k];
 		CHECKLIT(lit);
 		if (values[lit] > 0) {
 			clause.clear();
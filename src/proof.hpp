@@ -60,9 +60,11 @@ namespace SeqFROST {
 		void addClause			(CLAUSE&);
 		void addClause			(SCLAUSE&);
 		void addResolvent		(SCLAUSE&);
+		void addResolvent		(const uint32*, const int&);
 		void deleteClause		(Lits_t&);
 		void deleteClause		(CLAUSE&);
 		void deleteClause		(SCLAUSE&);
+		void deleteClause		(const uint32*, const int&);
 		void deleteClause		(SCLAUSE&, const uint32& def, const uint32& other);
 		void shrinkClause		(CLAUSE&);
 		void shrinkClause		(CLAUSE&, const uint32&);
@@ -56,8 +56,10 @@ bool Solver::prop()
 			SCLAUSE& c = scnf[*i];
 			assert(c.size());
 			if (c.deleted()) continue;
-			if (propClause(values, flipped, c))
+			if (propClause(values, flipped, c)) {
+				ot.touch(c);
 				c.markDeleted(); // clause satisfied by an assigned unit
+			}
 			else {
 				const int size = c.size();
 				if (!size) { learnEmpty(); return false; }
@@ -70,7 +72,8 @@ bool Solver::prop()
 			}
 		}
 		fot.clear(true);
-		toblivion(scnf, ot[assign]);
+		ot.touch(flipped);
+		toblivion(scnf, ot, assign);
 	}
 	numforced = sp->propagated - numforced;
 	if (numforced) {
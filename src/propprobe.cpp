@@ -24,7 +24,7 @@ using namespace SeqFROST;
 bool Solver::BCPProbe() 
 {
 	assert(UNSOLVED);
-	assert(LEVEL == 1);
+	assert(LEVEL);
 
 	conflict = UNDEF_REF;
 
@@ -42,10 +42,11 @@ bool Solver::BCPProbe()
 inline bool Solver::propBinary(const uint32& assign)
 {
 	CHECKLIT(assign);
-	assert(l2dl(assign) == 1);
+	assert(l2dl(assign) <= LEVEL);
 #ifdef LOGGING
 	LOG2(4, "  propagating %d@%d in binaries", l2i(assign), l2dl(assign));
 #endif
+	const uint32 level = LEVEL;
 	const LIT_ST* values = sp->value;
 	WL& ws = wt[assign];
 	forall_watches(ws, i) {
@@ -59,7 +60,7 @@ inline bool Solver::propBinary(const uint32& assign)
 			const C_REF ref = w.ref;
 			if (cm.deleted(ref)) continue;
 			if (impval) 
-				enqueue(imp, 1, ref);
+				enqueue(imp, level, ref);
 			else { 
 				conflict = ref; 
 				return true;
@@ -72,10 +73,11 @@ inline bool Solver::propBinary(const uint32& assign)
 inline bool Solver::propProbe(const uint32& assign)
 {
 	CHECKLIT(assign);
-	assert(l2dl(assign) == 1);
+	assert(l2dl(assign) <= LEVEL);
 #ifdef LOGGING
 	LOG2(4, "  propagating %d@%d in large clauses", l2i(assign), l2dl(assign));
 #endif
+	const uint32 level = LEVEL;
 	const uint32 flipped = FLIP(assign);
 	const LIT_ST* values = sp->value;
 	WL& ws = wt[assign];
@@ -88,7 +90,7 @@ inline bool Solver::propProbe(const uint32& assign)
 		if (w.binary()) {
 			if (cm.deleted(ref)) { j--; continue; }
 			if (impval) 
-				enqueue(imp, 1, ref);
+				enqueue(imp, level, ref);
 			else { 
 				conflict = ref; 
 				break; 
@@ -129,7 +131,7 @@ inline bool Solver::propProbe(const uint32& assign)
 
 					HYPER_BINARY(opts.probehbr_en, lits, csize, ref, other, flipped, j);
 
-					enqueue(other, 1, ref);
+					enqueue(other, level, ref);
 				}
 				else {
 					assert(!val);
@@ -0,0 +1,62 @@
+/***********************************************************************[propprofile.cpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "propprofile.hpp"
+
+#ifdef PROFILING
+
+using namespace SeqFROST;
+
+PROPPROFILE::PROPPROFILE() :
+	curr(NULL)
+{
+	RESETSTRUCT(&wlists);
+	RESETSTRUCT(&searches);
+	RESETSTRUCT(&sizes);
+}
+
+PROPPROFILE::~PROPPROFILE()
+{
+	lits.clear(true);
+	curr = NULL;
+}
+
+void PROPPROFILE::report()
+{
+	LOG1("\t\t\t%sPropagation Profile%s", CREPORT, CNORMAL);
+	wlists.report("Watch-list lengths");
+	sizes.report("Visited clause sizes");
+	searches.report("Replacement searches");
+}
+
+void PROPPROFILE::write(const char* path)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL) { LOGERRN("cannot open profile file %s", path); return; }
+	fprintf(file, "literal,props,watches,maxwatches,blockers,visits,satisfied,searches,searched,replaced,conflicts\n");
+	for (uint32 lit = 2; lit < lits.size(); ++lit) {
+		const LITPROFILE& p = lits[lit];
+		if (!p.props) continue;
+		fprintf(file, "%d,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld\n", l2i(lit),
+			p.props, p.watches, p.maxwatches, p.blockers, p.visits,
+			p.satisfied, p.searches, p.searched, p.replaced, p.conflicts);
+	}
+	fclose(file);
+}
+
+#endif
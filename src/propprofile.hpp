@@ -0,0 +1,93 @@
+/***********************************************************************[propprofile.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __PROPPROFILE_
+#define __PROPPROFILE_
+
+#include "definitions.hpp"
+#include "vector.hpp"
+#include "loghist.hpp"
+
+namespace SeqFROST {
+
+#ifdef PROFILING
+
+	/*****************************************************/
+	/*  Usage:   per-literal BCP profiling counters      */
+	/*  Dependency:  uint64                              */
+	/*****************************************************/
+
+	struct LITPROFILE {
+		uint64 props;		// times the literal was propagated
+		uint64 watches;		// accumulated watch-list lengths
+		uint64 maxwatches;	// longest watch list seen
+		uint64 blockers;	// watches skipped by a satisfied blocking literal
+		uint64 visits;		// large clauses dereferenced
+		uint64 satisfied;	// visited clauses satisfied by the other watch
+		uint64 searches;	// replacement searches
+		uint64 searched;	// literals scanned by replacement searches
+		uint64 replaced;	// watches moved to a new literal
+		uint64 conflicts;	// conflicts found in the literal watch list
+	};
+
+	class PROPPROFILE {
+
+		Vec<LITPROFILE> lits;
+		LOGHIST			wlists, searches, sizes;
+		LITPROFILE*		curr;
+
+	public:
+
+		PROPPROFILE		();
+		~PROPPROFILE	();
+
+		// 'orglit' is the propagated literal in terms of the original variables
+		inline void		propagate	(const uint32& orglit, const uint32& wsize) {
+			if (orglit >= lits.size()) lits.expand(orglit + 1);
+			curr = lits + orglit;
+			curr->props++;
+			curr->watches += wsize;
+			if (wsize > curr->maxwatches) curr->maxwatches = wsize;
+			wlists.add(wsize);
+		}
+		inline void		blocker		() { curr->blockers++; }
+		inline void		visit		(const int& size) { curr->visits++, sizes.add(size); }
+		inline void		satisfied	() { curr->satisfied++; }
+		inline void		search		(const uint64& scanned) {
+			curr->searches++;
+			curr->searched += scanned;
+			searches.add(scanned);
+		}
+		inline void		replace		() { curr->replaced++; }
+		inline void		conflict	() { curr->conflicts++; }
+		void			report		();
+		void			write		(const char* path);
+
+	};
+
+	// number of literals scanned by 'FIND_NEW_WATCH'
+	#define SEARCH_LENGTH(LITS,MID,END,CPTR,NOTFOUND,SIZE) \
+		((NOTFOUND) ? uint64((SIZE) - 2) : \
+		(CPTR) >= (MID) ? uint64((CPTR) - (MID) + 1) : \
+		uint64(((END) - (MID)) + ((CPTR) - (LITS) - 2) + 1))
+
+#endif
+
+}
+
+#endif
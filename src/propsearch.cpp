@@ -21,6 +21,63 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace SeqFROST;
 
+// restore implied literals of the saved trail once their
+// antecedents are re-assigned; the walk waits at a saved decision
+// that is still unassigned ('UNDEF_VAL') and drops the segment once
+// that decision is falsified; a saved literal is enqueued with its
+// saved reason only if that reason is still unit under the current 
+// assignment, otherwise the remaining saved segment is invalidated
+inline void Solver::restoreTrail()
+{
+	assert(savedpos < savedtrail.size());
+	const LIT_ST* values = sp->value;
+	const uint32* levels = sp->level;
+	const bool* deleted = cm.stencil();
+	const SAVED* saved = savedtrail.data();
+	const uint32 size = savedtrail.size();
+	uint32 pos = savedpos;
+	while (pos < size) {
+		const uint32 lit = saved[pos].lit;
+		const C_REF ref = saved[pos].ref;
+		CHECKLIT(lit);
+		const LIT_ST val = values[lit];
+		if (val > 0) { pos++; continue; }
+		if (DECISION(ref)) {
+			// retried once the decision is made again
+			if (UNASSIGNED(val)) break;
+			// diverged from the saved decision
+			pos = size;
+			break;
+		}
+		if (!val) { pos = size; break; }	// saved literal is falsified
+		if (CARDREASON(ref)) {
+			const uint32 reason = CARD_LIT(ref);
+			if (values[reason] <= 0) { pos = size; break; }
+			enqueue(lit, levels[ABS(reason)], ref);
+			stats.trailsave.restored++;
+			pos++;
+			continue;
+		}
+		if (deleted[ref]) { pos = size; break; }
+		CLAUSE& c = cm[ref];
+		uint32 flevel = 0;
+		bool found = false, unit = true;
+		forall_clause(c, k) {
+			const uint32 other = *k;
+			if (other == lit) { found = true; continue; }
+			if (values[other]) { unit = false; break; }
+			const uint32 otherlevel = levels[ABS(other)];
+			if (otherlevel > flevel) flevel = otherlevel;
+		}
+		if (!found || !unit) { pos = size; break; }
+		CHECKLEVEL(flevel);
+		enqueue(lit, flevel, ref);
+		stats.trailsave.restored++;
+		pos++;
+	}
+	savedpos = pos;
+}
+
 bool Solver::BCP()
 {
 	conflict = UNDEF_REF;
@@ -34,6 +91,7 @@ bool Solver::BCP()
 	bool isConflict = false;
 
 	while (!isConflict && sp->propagated < trail.size()) {
+		if (savedpos < savedtrail.size()) restoreTrail();
 		const uint32 assign = trail[sp->propagated++];
 		const uint32 flipped = FLIP(assign);
 		const uint32 level = l2dl(assign);
@@ -44,9 +102,16 @@ bool Solver::BCP()
 	#endif
 		WL& ws = wt[assign];
 		uint64 ticks = CACHELINES(ws.size()); // 64-byte cache line is assumed
+	#ifdef PROFILING
+		profiler.propagate(V2DEC(vorg[ABS(assign)], SIGN(assign)), ws.size());
+	#endif
 		WATCH* i = ws, *j = i, * wend = ws.end();
 		while (i != wend) {
 
+		#ifdef PROFILING
+			if (values[i->imp] > 0) profiler.blocker();
+		#endif
+
 			ADVANCE_WATCHES(w, imp, impval, ref, i, j, values);
 
 			if (w.binary()) {
@@ -67,14 +132,26 @@ bool Solver::BCP()
 
 				PREFETCH_LARGE_CLAUSE(c, lits, other, otherval, ref, flipped, values, cs);
 
-				if (otherval > 0) 
+			#ifdef PROFILING
+				profiler.visit(c.size());
+			#endif
+
+				if (otherval > 0) {
+				#ifdef PROFILING
+					profiler.satisfied();
+				#endif
 					(j - 1)->imp = other;				// satisfied, replace "w.imp" with new blocking "other"
+				}
 				else {
 					
 					const int csize = c.size();
 
 					FIND_NEW_WATCH(c, lits, c.pos(), csize, k, newlit, values);
 
+				#ifdef PROFILING
+					profiler.search(SEARCH_LENGTH(lits, MID, END, k, _FALSE_, csize));
+				#endif
+
 					LIT_ST val = values[newlit];
 
 					if (val > 0)						// found satisfied new literal (update "imp")
@@ -85,6 +162,10 @@ bool Solver::BCP()
 
 						ATTACH_WATCH(newlit, other, ref, csize);
 
+					#ifdef PROFILING
+						profiler.replace();
+					#endif
+
 						j--;							// remove j-watch from current assignment
 
 						ticks++;
@@ -106,9 +187,26 @@ bool Solver::BCP()
 
 		RECOVER_WATCHES(ws, wend, i, j);
 
+	#ifdef PROFILING
+		if (NEQUAL(conflict, UNDEF_REF)) profiler.conflict();
+	#endif
+
 		stats.searchticks += ticks;
 
 		isConflict = NEQUAL(conflict, UNDEF_REF);
+
+		// at-most-one constraints allocate their conflicts on the fly
+		if (!isConflict && cards.watched(assign)) {
+			isConflict = propCards(assign);
+			cs = cm.address(0), deleted = cm.stencil();
+		}
+
+		// XOR propagation once clauses are exhausted; reason clauses
+		// are allocated on the fly so clause pointers are refreshed
+		if (!isConflict && gauss.nrows && sp->propagated == trail.size()) {
+			isConflict = propGauss();
+			cs = cm.address(0), deleted = cm.stencil();
+		}
 	} // end of trail loop
 
 	stats.searchprops += sp->propagated - propsbefore;
@@ -82,7 +82,7 @@ void Solver::markReasons()
 		assert(sp->level[v]);
 		CHECKLEVEL(sp->level[v]);
 		const C_REF r = sources[v];
-		if (REASON(r)) {
+		if (REASON(r) && !CARDREASON(r)) {
 			GET_CLAUSE(c, r, cs);
 			assert(!c.reason());
 			c.markReason();
@@ -102,7 +102,7 @@ void Solver::unmarkReasons()
 		assert(sp->level[v]);
 		CHECKLEVEL(sp->level[v]);
 		const C_REF r = sources[v];
-		if (REASON(r)) {
+		if (REASON(r) && !CARDREASON(r)) {
 			GET_CLAUSE(c, r, cs);
 			assert(c.reason());
 			c.initReason();
@@ -140,6 +140,7 @@ void Solver::recycle(CMM& new_cm)
 	reduced.clear(true);
 	analyzed.clear(true);
 	minimized.clear(true);
+	minstack.clear(true);
 
 	PREFETCH_CM(cs, deleted);
 
@@ -158,6 +159,7 @@ void Solver::recycle(CMM& new_cm)
 		C_REF& r = sources[v];
 		if (REASON(r)) {
 			if (levels[v]) {
+				if (CARDREASON(r)) continue;
 				assert(r < cm.size());
 				if (deleted[r]) 
 					r = UNDEF_REF;
@@ -202,6 +204,8 @@ void Solver::recycle()
 #endif
 		LOGENDING(2, 5, "(%.3f KB collected)", ratio((double)(cm.garbage() * cm.bucket()), (double)KBYTE)); 
 		new_cm.migrateTo(cm);
+		clearSavedTrail();
+		gauss.reasons.clear();
 	}
 	else {
 		stats.recycle.soft++;
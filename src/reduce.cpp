@@ -90,8 +90,11 @@ void Solver::reduce()
 	recycle();
 	unmarkReasons();
 	INCREASE_LIMIT(reduce, stats.reduces, nbylogn, false);
-	if (shrunken && canMap()) 
+	if (shrunken && canMap()) {
 		map(); // "recycle" must be called beforehand
+		buildGauss();
+	}
+	hashClauses();
 }
 
 void Solver::reduceLearnts()
@@ -32,14 +32,29 @@ void Solver::ERE()
 	const int ereextend = opts.ere_extend;
 	const int maxoccurs = opts.ere_max_occurs;
 	const int maxsize = opts.ere_clause_max;
+	const int hashmin = opts.ere_hash_min;
 #ifdef STATISTICS
 	ERESTATS& erestats = stats.simplify.ere;
 #endif
 	Lits_t merged;
 	merged.reserve(maxsize);
+	uVec1D stale;
+	cnf_refs_t strengthened;
+	SET_BOUNDS(limit, ere, simplify.ticks.ere, searchticks, inf.nLiterals);
+	uint64& ticks = stats.simplify.ticks.ere;
+	// resolvents with long shortest lists are looked up in a
+	// hash index built on demand instead of scanning them
+	CHASH table;
+	uint64 longscans = 0;
+	bool hashed = false;
 	forall_vector(uint32, elected, e) {
 		const uint32 x = *e;
 		CHECKVAR(x);
+		// a variable is either fully checked or left as is
+		if (ticks > limit) {
+			LOG2(2, "  ERE budget exhausted");
+			break;
+		}
 		uint32 dx = V2L(x), fx = NEG(dx);
 
 		if (ot[dx].size() > ot[fx].size()) std::swap(dx, fx);
@@ -52,7 +67,7 @@ void Solver::ERE()
 			if (scnf[*me].size() > maxsize || scnf[*other].size() > maxsize)
 				continue;
 			// do merging and apply forward subsumption
-			// check (on-the-fly) over resolvents			
+			// check (on-the-fly) over resolvents
 			forall_occurs(me, i) {
 				const S_REF iref = *i;
 				SCLAUSE& ci = scnf[iref];
@@ -65,60 +80,114 @@ void Solver::ERE()
 					const bool cjorg = cj.original();
 					// merge
 					uint32 sig, best;
+					ticks++;
 					int len = merge_ere(x, ci, cj, ot, maxsize, merged, sig, best);
-                    assert(len <= maxsize);
-					if (len < 2) continue;                                 
-                    // forward check
-                #ifdef STATISTICS
-                    erestats.tried++;
-                #endif
-                    CHECKLIT(best);
-                    OL& minlist = ot[best];
+					assert(len <= maxsize);
+					if (len < 2) continue;
+					// forward check
+				#ifdef STATISTICS
+					erestats.tried++;
+				#endif
+					strengthened.clear();
+					// returns true once a clause equal to 'merged' is removed
+					auto check = [&](const S_REF& mref) {
+						ticks++;
+						if (mref == iref || mref == jref) return false;
+						SCLAUSE& c = scnf[mref];
+						if (c.deleted()) return false;
+						const int csize = c.size();
+						if (len > csize || !sub(sig, c.sig()) || !sub(merged, c)) return false;
+						const bool learnt = c.learnt();
+						if (len == csize) {
+							if (!learnt && !(ciorg && cjorg)) return false;
+							LOGCLAUSE(4, c, " Redundant");
+						#ifdef STATISTICS
+							if (learnt) erestats.learntremoved++;
+							else erestats.orgremoved++;
+						#endif
+							removeClause(c);
+							LOGCLAUSE(4, c, " By merged");
+							return true;
+						}
+						if (ereextend && (!learnt || ereextend > 1))
+							strengthened.push(mref);
+						return false;
+					};
+					CHECKLIT(best);
+					OL& minlist = ot[best];
 					assert(minlist.size());
-                    forall_occurs(minlist, m) {
-                        const S_REF mref = *m;
-                        if (mref == iref || mref == jref) 
-							continue;
-                        SCLAUSE& c = scnf[mref];
-                        if (c.deleted()) continue;
-                        const int csize = c.size();
-                        if (len <= csize && sub(sig, c.sig()) && sub(merged, c)) {
-							const bool learnt = c.learnt();
-							const bool equal = len == csize;
-                            if (equal && (learnt || (ciorg && cjorg))) { // can be removed
-                                LOGCLAUSE(4, c, " Redundant");	
-                            #ifdef STATISTICS
-                                if (learnt) erestats.learntremoved++;
-                                else erestats.orgremoved++;
-                            #endif
-                                removeClause(c);
-								LOGCLAUSE(4, c, " By merged");	
-                                break;
-                            }
-                            else if (!equal && ereextend) { // can be strengthened
-								if (learnt && ereextend == 1) continue;
-                                LOGCLAUSE(4, c, " Strengthened");	
-							#ifdef STATISTICS
-								if (learnt) erestats.learntstrengthened++;
-								else erestats.orgstrengthened++;
-							#endif
-								assert(merged.size() == len);
-								if (opts.proof_en) {
-									proof.addClause(merged);							
-									proof.deleteClause(c);
-								}
-								c.copyLitsFrom(merged);
-								c.resize(len);
-								if (learnt)
-									bumpShrunken(c);
-                                LOGCLAUSE(4, c, " By merged   ");
-                            }
-                        }
-                    }		
+					const int minsize = minlist.size();
+					// long lists are scanned until that costs as much as the index
+					if (!hashed && minsize > hashmin && longscans > inf.nLiterals) {
+						hashERE(table, maxsize);
+						ticks += table.size();
+						hashed = true;
+					}
+					if (minsize <= hashmin || !hashed) {
+						if (minsize > hashmin) longscans += minsize;
+						forall_occurs(minlist, m) {
+							if (check(*m)) break;
+						}
+					}
+					else table.find(fingerprint(merged.data(), len), check);
+					// can be strengthened
+					forall_vector(S_REF, strengthened, s) {
+						const S_REF sref = *s;
+						SCLAUSE& c = scnf[sref];
+						if (c.deleted() || c.size() <= len) continue;
+						const bool learnt = c.learnt();
+						LOGCLAUSE(4, c, " Strengthened");
+					#ifdef STATISTICS
+						if (learnt) erestats.learntstrengthened++;
+						else erestats.orgstrengthened++;
+					#endif
+						assert(merged.size() == len);
+						if (opts.proof_en) {
+							proof.addClause(merged);
+							proof.deleteClause(c);
+						}
+						// 'c' leaves the lists of its removed literals
+						int m = 0;
+						forall_clause(c, k) {
+							const uint32 lit = *k;
+							if (m < len && merged[m] == lit) m++;
+							else stale.push(lit);
+						}
+						c.copyLitsFrom(merged);
+						c.resize(len);
+						if (learnt)
+							bumpShrunken(c);
+						if (hashed)
+							hash_ere(table, c, sref, maxsize);
+						LOGCLAUSE(4, c, " By merged   ");
+					}
 				}
 			}
 		}
 	}
+	if (hashed) table.clear(true);
+	forall_vector(uint32, stale, i) {
+		const uint32 lit = *i;
+		OL& ol = ot[lit];
+		S_REF* j = ol;
+		forall_occurs(ol, k) {
+			SCLAUSE& c = scnf[*k];
+			if (c.deleted() || c.has(lit)) *j++ = *k;
+		}
+		ol.resize(int(j - ol));
+		ot.touch(lit);
+	}
 	if (opts.profile_simplifier) timer.pstop(), timer.ere += timer.pcpuTime();
 	LOGREDCL(this, 2, "ERE Reductions");
-}
\ No newline at end of file
+}
+
+void Solver::hashERE(CHASH& table, const int& maxsize)
+{
+	table.reserve(inf.nClauses);
+	const uint32 nclauses = scnf.size();
+	for (uint32 i = 0; i < nclauses; ++i) {
+		const S_REF r = scnf.ref(i);
+		SCLAUSE& c = scnf[r];
+		if (!c.deleted()) hash_ere(table, c, r, maxsize);
+	}
+}
@@ -20,9 +20,32 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __ERE_
 
 #include "simplify.hpp"
+#include "hash.hpp"
 
 using namespace SeqFROST;
 
+// index 'c' by its literals if it may equal a resolvent of at most
+// 'maxlen' literals, and by every subset missing one literal if it
+// may be strengthened to such a resolvent
+inline void hash_ere(CHASH& table, SCLAUSE& c, const S_REF& ref, const int& maxlen)
+{
+	assert(!c.deleted());
+	const int size = c.size();
+	if (size < 2 || size > maxlen + 1) return;
+	// same sum as 'fingerprint', so a literal is dropped by subtraction
+	uint64 key = uint64(size) * HASH_MUL;
+	forall_clause(c, k) {
+		key += hashLit(*k);
+	}
+	if (size <= maxlen) table.insert(key == HASH_EMPTY ? 1 : key, ref);
+	if (size == 2) return;
+	const uint64 dropped = key - HASH_MUL;
+	forall_clause(c, k) {
+		const uint64 subkey = dropped - hashLit(*k);
+		table.insert(subkey == HASH_EMPTY ? 1 : subkey, ref);
+	}
+}
+
 inline int merge_ere(const uint32& x, 
 					 SCLAUSE& c1, 
 					 SCLAUSE& c2, 
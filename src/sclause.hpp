@@ -97,6 +97,21 @@ namespace SeqFROST {
 		{
 			copyLits(src);
 		}
+		finline			SCLAUSE		(const uint32* lits, const int& size) :
+			_st(ORIGINAL)
+			, _f(0)
+			, _a(0)
+			, _u(0)
+			, _lbd(0)
+			, _sig(0)
+			, _sz(size)
+		{
+			assert(_sz > 0);
+			for (int k = 0; k < _sz; ++k) {
+				CHECKLIT(lits[k]);
+				_lits[k] = lits[k];
+			}
+		}
 		template <class SRC>
 		finline void	copyLits(const SRC& src) {
 			assert(_sz > 0 && _sz <= src.size());
@@ -123,6 +138,7 @@ namespace SeqFROST {
 		finline uint32	operator [] (const int& i) const { assert(i < _sz); return _lits[i]; }
 		finline operator uint32*	()		 { assert(_sz >= 0); return _lits; }
 		finline uint32*	data		()		 { return _lits; }
+		finline const uint32* data	() const { return _lits; }
 		finline uint32*	end			()		 { return _lits + _sz; }
 		finline void	pop			()		 { assert(_sz > 0); _sz--; }
 		finline void	freeze		()		 { _f = 0; }
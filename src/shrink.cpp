@@ -63,6 +63,7 @@ void Solver::shrinkClause(CLAUSE& c, const int& remLits)
 		assert(c.original());
 		assert(stats.literals.original > 0);
 		stats.literals.original -= remLits;
+		mark_touched(c);
 	}
 	if (keeping(c)) 
 		mark_subsume(c);
@@ -0,0 +1,119 @@
+/***********************************************************************[simd.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SIMD_
+#define __SIMD_
+
+#include "definitions.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace SeqFROST {
+
+	/*****************************************************/
+	/*  Usage: kernels over two sorted literal arrays    */
+	/*         where each literal of 'a' is broadcast    */
+	/*         and compared to a window of 'b' at once;  */
+	/*         the window only slides forward, so the    */
+	/*         scalar loop resumes where vectors stop    */
+	/*  Dependency: AVX2 (-mavx2) or SSE2 (x86-64)       */
+	/*****************************************************/
+
+	// number of literals in both 'a' and 'b'
+	inline int countShared(const uint32* a, const int& na, const uint32* b, const int& nb)
+	{
+		int i = 0, j = 0, shared = 0;
+	#if defined(__AVX2__)
+		while (i < na && j + 8 <= nb) {
+			const uint32 lit = a[i];
+			if (b[j + 7] < lit) { j += 8; continue; }
+			const __m256i window = _mm256_loadu_si256((const __m256i*)(b + j));
+			const __m256i eq = _mm256_cmpeq_epi32(_mm256_set1_epi32(int(lit)), window);
+			shared += !_mm256_testz_si256(eq, eq);
+			i++;
+		}
+	#endif
+	#if defined(__SSE2__)
+		while (i < na && j + 4 <= nb) {
+			const uint32 lit = a[i];
+			if (b[j + 3] < lit) { j += 4; continue; }
+			const __m128i window = _mm_loadu_si128((const __m128i*)(b + j));
+			const __m128i eq = _mm_cmpeq_epi32(_mm_set1_epi32(int(lit)), window);
+			shared += _mm_movemask_epi8(eq) != 0;
+			i++;
+		}
+	#endif
+		while (i < na && j < nb) {
+			const uint32 lit1 = a[i], lit2 = b[j];
+			if (lit1 < lit2) i++;
+			else if (lit2 < lit1) j++;
+			else shared++, i++, j++;
+		}
+		return shared;
+	}
+
+	// count literals shared by 'a' and 'b' when resolved on 'x';
+	// returns false once a complementary pair not on 'x' is found
+	inline bool countResolved(const uint32& x, const uint32* a, const int& na, const uint32* b, const int& nb, int& shared)
+	{
+		int i = 0, j = 0;
+		shared = 0;
+	#if defined(__AVX2__)
+		while (i < na && j + 8 <= nb) {
+			const uint32 lit = a[i], v = ABS(lit);
+			if (v == x) { i++; continue; }
+			if (ABS(b[j + 7]) < v) { j += 8; continue; }
+			const __m256i window = _mm256_loadu_si256((const __m256i*)(b + j));
+			const __m256i neq = _mm256_cmpeq_epi32(_mm256_set1_epi32(int(FLIP(lit))), window);
+			if (!_mm256_testz_si256(neq, neq)) return false;
+			const __m256i eq = _mm256_cmpeq_epi32(_mm256_set1_epi32(int(lit)), window);
+			shared += !_mm256_testz_si256(eq, eq);
+			i++;
+		}
+	#endif
+	#if defined(__SSE2__)
+		while (i < na && j + 4 <= nb) {
+			const uint32 lit = a[i], v = ABS(lit);
+			if (v == x) { i++; continue; }
+			if (ABS(b[j + 3]) < v) { j += 4; continue; }
+			const __m128i window = _mm_loadu_si128((const __m128i*)(b + j));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_set1_epi32(int(FLIP(lit))), window))) return false;
+			shared += _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_set1_epi32(int(lit)), window)) != 0;
+			i++;
+		}
+	#endif
+		while (i < na && j < nb) {
+			const uint32 lit1 = a[i], lit2 = b[j];
+			const uint32 v1 = ABS(lit1), v2 = ABS(lit2);
+			if (v1 == x) i++;
+			else if (v2 == x) j++;
+			else if ((lit1 ^ lit2) == NEG_SIGN) return false;
+			else if (v1 < v2) i++;
+			else if (v2 < v1) j++;
+			else shared++, i++, j++;
+		}
+		return true;
+	}
+
+}
+
+#endif
@@ -20,6 +20,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "control.hpp"
 #include "sort.hpp"
 #include "can.hpp"
+#include "threads.hpp"
 
 using namespace SeqFROST;
 
@@ -36,28 +37,157 @@ inline bool	Solver::checkMem(const string& name, const size_t& size)
 	return true;
 }
 
+// literals or variables handed to a thread at once
+constexpr uint32 OT_CHUNK = 1024;
+
 void Solver::createOT(const bool& reset)
 {
 	if (opts.profile_simplifier) timer.pstart();
+	// count occurrences, lay out all lists in one contiguous
+	// table, then fill them in 'scnf' order where every thread 
+	// owns a range of literals, hence the table does not depend
+	// on the number of threads
+	const uint32 nlits = ot.size();
 	if (reset) {
-		forall_variables(v) { 
-			const uint32 p = V2L(v); 
-			ot[p].clear(); 
-			ot[NEG(p)].clear();
+		for (uint32 lit = 0; lit < nlits; ++lit)
+			ot[lit].clear();
+	}
+	ot.untouch();
+	ot.deferred().clear();
+	const uint32 nthreads = nThreads(opts.simp_threads, nlits, OT_CHUNK);
+	const uint32 range = (nlits + nthreads - 1) / nthreads;
+	uVec1D counts(nlits, 0);
+	runThreads(nthreads, [&](const uint32 tid) {
+		const uint32 begin = tid * range;
+		const uint32 end = MIN(begin + range, nlits);
+		if (begin < end) countOT(begin, end, counts);
+	});
+	ot.layout(counts);
+	runThreads(nthreads, [&](const uint32 tid) {
+		const uint32 begin = tid * range;
+		const uint32 end = MIN(begin + range, nlits);
+		if (begin < end) fillOT(begin, end);
+	});
+	indexed = scnf.size();
+	// the histogram of LCVE is read off the list sizes
+	occurs.resize(inf.maxVar + 1);
+	// pending changes are dropped above, so VE forgets its failures
+	nogate.resize(inf.maxVar + 1, 0);
+	noblocked.resize(inf.maxVar + 1, 0);
+	witnesses.clear(true);
+	OCCUR* occs = occurs.data();
+	forall_variables(v) {
+		const uint32 p = V2L(v);
+		occs[v].ps = ot[p].size();
+		occs[v].ns = ot[NEG(p)].size();
+	}
+	if (opts.profile_simplifier) timer.pstop(), timer.cot += timer.pcpuTime();
+}
+
+void Solver::updateOT()
+{
+	if (opts.profile_simplifier) timer.pstart();
+	// only clauses added or substituted by the previous 
+	// phase are inserted, then the touched lists are synced
+	forall_vector(DEFERRED, ot.deferred(), d) {
+		if (scnf[d->ref].deleted()) continue;
+		ot.push(d->lit, d->ref);
+		ot.touch(d->lit);
+	}
+	ot.deferred().clear();
+	indexOT();
+	syncOT();
+	if (opts.profile_simplifier) timer.pstop(), timer.cot += timer.pcpuTime();
+}
+
+void Solver::indexOT()
+{
+	// insert clauses appended to 'scnf' since the last index
+	const uint32 nclauses = scnf.size();
+	for (uint32 i = indexed; i < nclauses; ++i) {
+		const S_REF r = scnf.ref(i);
+		SCLAUSE& c = scnf[r];
+		if (c.learnt() || c.original()) {
+			forall_clause(c, k) {
+				const uint32 lit = *k;
+				CHECKLIT(lit);
+				ot.push(lit, r);
+				ot.touch(lit);
+			}
+		}
+	}
+	indexed = nclauses;
+}
+
+void Solver::syncOT()
+{
+	// drop deleted clauses from the touched lists, restore
+	// their 'scnf' (ascending reference) order and update
+	// the histogram of their literals
+	uVec1D& touched = ot.touched();
+	const uint32 ntouched = touched.size();
+	if (!ntouched) return;
+	OCCUR* occs = occurs.data();
+	const uint32 nthreads = nThreads(opts.simp_threads, ntouched, OT_CHUNK);
+	CHUNKS chunks(ntouched, OT_CHUNK);
+	runThreads(nthreads, [&](const uint32 tid) {
+		uint32 begin, end;
+		while (chunks.pop(begin, end)) {
+			for (uint32 i = begin; i < end; ++i) {
+				const uint32 lit = touched[i];
+				CHECKLIT(lit);
+				OL& ol = ot[lit];
+				syncOL(ol);
+				if (SIGN(lit)) occs[ABS(lit)].ns = ol.size();
+				else occs[ABS(lit)].ps = ol.size();
+			}
+		}
+	});
+	// changes of this phase make their variables eligible
+	// and worth another elimination attempt
+	forall_vector(uint32, touched, i) {
+		const uint32 lit = *i;
+		touchVar(ABS(lit));
+		if (ot.changed(lit)) {
+			nogate[ABS(lit)] = 0;
+			noblocked[ABS(lit)] = 0;
+			rescheduleVE(ABS(lit));
+		}
+	}
+	ot.untouch();
+}
+
+inline void Solver::countOT(const uint32& begin, const uint32& end, uVec1D& counts)
+{
+	assert(begin < end);
+	forall_sclauses(scnf, i) {
+		SCLAUSE& c = scnf[*i];
+		if (c.learnt() || c.original()) {
+			assert(c.size());
+			forall_clause(c, k) { 
+				const uint32 lit = *k;
+				CHECKLIT(lit);
+				if (lit >= begin && lit < end)
+					counts[lit]++;
+			}
 		}
 	}
+}
+
+inline void Solver::fillOT(const uint32& begin, const uint32& end)
+{
+	assert(begin < end);
 	forall_sclauses(scnf, i) {
 		const S_REF r = *i;
 		SCLAUSE& c = scnf[r];
 		if (c.learnt() || c.original()) {
-			assert(c.size());
 			forall_clause(c, k) { 
-				CHECKLIT(*k);
-				ot[*k].push(r);
+				const uint32 lit = *k;
+				if (lit >= begin && lit < end)
+					ot[lit].insert(r);
 			}
 		}
 	}
-	if (opts.profile_simplifier) timer.pstop(), timer.cot += timer.pcpuTime();
 }
 
 void Solver::reduceOL(OL& ol)
@@ -71,30 +201,67 @@ void Solver::reduceOL(OL& ol)
 	ol.resize(int(j - ol));
 }
 
+void Solver::syncOL(OL& ol)
+{
+	reduceOL(ol);
+	const int size = ol.size();
+	int k = 1;
+	while (k < size && ol[k - 1] < ol[k]) k++;
+	if (k >= size) return;
+	// sorted by 'sortOT' or got a substituted clause
+	SORT(ol);
+	S_REF* j = ol.data() + 1;
+	for (S_REF* i = j, *end = ol.end(); i != end; ++i) {
+		if (*i != j[-1]) *j++ = *i;
+	}
+	ol.resize(int(j - ol));
+}
+
 void Solver::reduceOT()
 {
 	if (opts.profile_simplifier) timer.pstart();
-	forall_variables(v) {
-		const uint32 p = V2L(v), n = NEG(p);
-		reduceOL(ot[p]);
-		reduceOL(ot[n]);
-	}
+	const uint32 nvars = inf.maxVar;
+	const uint32 nthreads = nThreads(opts.simp_threads, nvars, OT_CHUNK);
+	CHUNKS chunks(nvars, OT_CHUNK);
+	runThreads(nthreads, [&](const uint32 tid) {
+		uint32 begin, end;
+		while (chunks.pop(begin, end)) {
+			for (uint32 v = begin + 1; v <= end; ++v) {
+				const uint32 p = V2L(v), n = NEG(p);
+				reduceOL(ot[p]);
+				reduceOL(ot[n]);
+			}
+		}
+	});
 	if (opts.profile_simplifier) timer.pstop(), timer.rot += timer.pcpuTime();
 }
 
 void Solver::sortOT()
 {
 	if (opts.profile_simplifier) timer.pstart();
-	CNF_CMP_KEY cmp(scnf);
+	const uint32 nelected = elected.size();
+	const uint32 nthreads = nThreads(opts.simp_threads, nelected, OT_CHUNK);
+	CHUNKS chunks(nelected, OT_CHUNK);
+	runThreads(nthreads, [&](const uint32 tid) {
+		CNF_CMP_KEY cmp(scnf);
+		uint32 begin, end;
+		while (chunks.pop(begin, end)) {
+			for (uint32 i = begin; i < end; ++i) {
+				CHECKVAR(elected[i]);
+				const uint32 p = V2L(elected[i]), n = NEG(p);
+				OL& poss = ot[p], &negs = ot[n];
+				const int ps = poss.size(), ns = negs.size();
+				if (ps > 1) 
+					SORTCMP(poss, cmp);
+				if (ns > 1) 
+					SORTCMP(negs, cmp);
+			}
+		}
+	});
+	// lists are back in 'scnf' order on the next sync
 	forall_vector(uint32, elected, i) {
-		CHECKVAR(*i);
-		const uint32 p = V2L(*i), n = NEG(p);
-		OL& poss = ot[p], &negs = ot[n];
-		const int ps = poss.size(), ns = negs.size();
-		if (ps > 1) 
-			SORTCMP(poss, cmp);
-		if (ns > 1) 
-			SORTCMP(negs, cmp);
+		const uint32 p = V2L(*i);
+		ot.reorder(p), ot.reorder(NEG(p));
 	}
 	if (opts.profile_simplifier) timer.pstop(), timer.sot += timer.pcpuTime();
 }
@@ -136,17 +303,21 @@ void Solver::awaken()
 { 
 	printStats(1, '-', CGREEN0);
 	initSimp();
+	gauss.destroy();
 	LOGN2(2, " Allocating memory..");
 	wt.clear(true);
 	ot.resize(inf.nDualVars);
 	scnf.init(MAXCLAUSES, MAXLITERALS);
 	LOGENDING(2, 5, "(%.1f MB used)", 
-		(double(ot.capacity()) + double(scnf.capacity())) / MBYTE);
+		(double(ot.memory()) + double(scnf.capacity())) / MBYTE);
 	LOGN2(2, " Extracting clauses to simplifying CNF..");
 	inf.nClauses = inf.nLiterals = 0;
 	extract(orgs), orgs.clear(true);
 	extract(learnts), learnts.clear(true);
+	extractCards();
 	cm.destroy();
+	chash.clear(true);
+	clearSavedTrail();
 	LOGENDING(2, 5, "(%d clauses extracted)", inf.nClauses);
 	LOGMEMCALL(this, 2);
 	return;
@@ -160,7 +331,8 @@ void Solver::simplifying()
 	SLEEPING(sleep.simplify, opts.simplify_sleep_en);
 	rootify();
 	shrinkTop(false);
-	if (orgs.empty()) {
+	if (orgs.empty() || !ntouched) {
+		if (!ntouched) LOG2(2, " No variables touched since the last simplification");
 		PREFETCH_CM(cs, deleted);
 		recycleWT(cs, deleted);
 		return;
@@ -181,13 +353,17 @@ void Solver::simplifying()
 	int64 bmelted = inf.maxMelted, bclauses = inf.nClauses, bliterals = inf.nLiterals;
 	int64 litsbefore = inf.nLiterals, diff = INT64_MAX;
 	while (litsbefore) {
-		resizeCNF();
-		createOT();
+		if (!phase || resizeCNF()) createOT();
+		else updateOT();
 		if (!prop()) killSolver();
 		if (!LCVE()) break;
 		sortOT();
 		if (stopping(phase, diff)) { ERE(); break; }
-		SUB(), VE(), BCE();
+		SUB(), VE();
+		uVec1D survivors;
+		for (int round = 1; round < opts.ve_rounds && reelectVE(survivors); ++round) VE();
+		keepElected(survivors);
+		BCE();
 		countAll(), filterElected();
 		inf.nClauses = inf.nClausesAfter, inf.nLiterals = inf.nLiteralsAfter;
 		diff = litsbefore - inf.nLiterals, litsbefore = inf.nLiterals;
@@ -203,9 +379,13 @@ void Solver::simplifying()
 	// are nothing to add
 	if (!prop()) killSolver(); 
 	assert(sp->propagated == trail.size());
-	if (INTERRUPTED) killSolver();
-	occurs.clear(true), ot.clear(true);
+	// function cores of the last elections are kept in 'marks'
 	clearMapFrozen();
+	AMO(), BVA();
+	if (INTERRUPTED) killSolver();
+	occurs.clear(true), nogate.clear(true), noblocked.clear(true), ot.clear(true);
+	witnesses.clear(true);
+	elimcosts.clear(true), eschedule.destroy();
 	countFinal();
 	shrinkSimp();
 	assert(inf.nClauses == scnf.size());
@@ -215,16 +395,19 @@ void Solver::simplifying()
 	stats.simplify.all.literals += bliterals - int64(inf.nLiterals);
 	last.shrink.removed = stats.shrunken;
 	if (inf.maxFrozen > sp->simplified) stats.units.forced += inf.maxFrozen - sp->simplified;
-	if (!inf.unassigned || !inf.nClauses) { 
+	if (!inf.unassigned || (!inf.nClauses && cards.empty())) { 
 		LOG2(2, " Formula is SATISFIABLE by elimination");
 		SET_SAT; 
 		printStats(1, 's', CGREEN); 
 		return;
 	}
 	if (canMap()) map(true); 
-	else newBeginning();
+	else newBeginning(), cards.attach(inf.nDualVars);
 	rebuildWT(opts.simplify_priorbins);
+	clearTouched();
+	hashClauses();
 	if (retrail()) LOG2(2, " Propagation after simplify proved a contradiction");
+	else buildGauss();
 	UPDATE_SLEEPER(simplify, success);
 	printStats(1, 's', CGREEN);
 	if (!opts.profile_simplifier) timer.stop(), timer.simplify += timer.cpuTime();
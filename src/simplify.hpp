@@ -20,12 +20,16 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __SIMPLIFY_
 
 #include "solve.hpp" 
+#include "simd.hpp"
 
 using namespace SeqFROST;
 
 #define RESOLUTION 1
 #define SUBSTITUTION 2
 #define CORESUBSTITUTION 4
+#define PURELITERAL 8
+#define BUFFERGATE 16
+#define CONTRADICTION 32
 
 struct CNF_CMP_KEY {
 	const SCNF& scnf;
@@ -68,6 +72,16 @@ struct STABLE_CNF_KEY {
 	}
 };
 
+struct BVA_MATCH_CMP {
+	inline bool operator () (const BVAMATCH& a, const BVAMATCH& b) const {
+		if (a.lit < b.lit) return true;
+		if (a.lit > b.lit) return false;
+		if (a.cls < b.cls) return true;
+		if (a.cls > b.cls) return false;
+		return a.ref < b.ref;
+	}
+};
+
 inline void printGate(const SCNF& scnf, const OL& poss, const OL& negs)
 {
 	for (int i = 0; i < poss.size(); ++i) {
@@ -116,6 +130,17 @@ inline bool checkMolten(const SCNF& scnf, const OL& poss, const OL& negs)
 	return true;
 }
 
+inline bool checkOccurs(const OT& ot, const OCCUR* occs, const State_t* states, const uint32& maxvar)
+{
+	for (uint32 v = 1; v <= maxvar; ++v) {
+		if (states[v].state) continue;
+		const uint32 p = V2L(v), n = NEG(p);
+		if (occs[v].ps != uint32(ot[p].size()) || occs[v].ns != uint32(ot[n].size()))
+			return false;
+	}
+	return true;
+}
+
 inline bool sub(const uint32& A, const uint32& B) { return !(A & ~B); }
 
 inline bool selfsub(const uint32& A, const uint32& B)
@@ -162,20 +187,9 @@ inline bool isTautology(const uint32& x, const SCLAUSE& c1, const SCLAUSE& c2)
 	assert(c1.original());
 	assert(c2.original());
 	const int n1 = c1.size(), n2 = c2.size();
-	int it1 = 0, it2 = 0;
-	while (it1 < n1 && it2 < n2) {
-		const uint32 lit1 = c1[it1], lit2 = c2[it2];
-		CHECKLIT(lit1);
-		CHECKLIT(lit2);
-		const uint32 v1 = ABS(lit1), v2 = ABS(lit2);
-		if (v1 == x) { it1++; }
-		else if (v2 == x) { it2++; }
-		else if ((lit1 ^ lit2) == NEG_SIGN) return true; 
-		else if (v1 < v2) it1++;
-		else if (v2 < v1) it2++;
-		else { it1++; it2++; }
-	}
-	return false;
+	int shared;
+	if (n1 <= n2) return !countResolved(x, c1.data(), n1, c2.data(), n2, shared);
+	return !countResolved(x, c2.data(), n2, c1.data(), n1, shared);
 }
 
 inline bool merge(const uint32& x, SCLAUSE& c1, SCLAUSE& c2, Lits_t& out_c)
@@ -231,32 +245,14 @@ inline int merge(const uint32& x, SCLAUSE& c1, SCLAUSE& c2)
 	assert(c1.original());
 	assert(c2.original());
 	const int n1 = c1.size(), n2 = c2.size();
-	uint32* d1 = c1.data();
-	uint32* d2 = c2.data();
-	uint32* e1 = d1 + n1;
-	uint32* e2 = d2 + n2;
-	uint32 lit1, lit2, v1, v2;
-	int len = n1 + n2 - 2;
-	while (d1 != e1 && d2 != e2) {
-		lit1 = *d1;
-		lit2 = *d2;
-		CHECKLIT(lit1);
-		CHECKLIT(lit2);
-		v1 = ABS(lit1);
-		v2 = ABS(lit2);
-		if (v1 == x) d1++;
-		else if (v2 == x) d2++;
-		else if ((lit1 ^ lit2) == NEG_SIGN) return 0;
-		else if (v1 < v2) d1++;
-		else if (v2 < v1) d2++;
-		else { // repeated literal
-			assert(lit1 == lit2);
-			d1++, d2++;
-			assert(len > 0);
-			len--;
-		}
-	}
-	return len;
+	int shared;
+	// the shorter clause is broadcast against the longer one
+	const bool resolved = n1 <= n2 
+		? countResolved(x, c1.data(), n1, c2.data(), n2, shared)
+		: countResolved(x, c2.data(), n2, c1.data(), n1, shared);
+	if (!resolved) return 0;
+	assert(n1 + n2 - 2 - shared >= 0);
+	return n1 + n2 - 2 - shared;
 }
 
 inline void freezeBinaries(SCNF& scnf, OL& list)
@@ -310,8 +306,9 @@ inline bool countSubstituted(const uint32& x, const int& clsbefore, SCNF& scnf,
 				if (cj.original()) {
 					const bool b = cj.molten();
 					int rsize;
-					if (a != b && (rsize = merge(x, ci, cj)) > 1) {
-						if (++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return true;
+					if (a != b && (rsize = merge(x, ci, cj))) {
+						// unit resolvents are left to self-subsumption
+						if (rsize == 1 || ++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return true;
 						nAddedLits += rsize;
 					}
 				}
@@ -340,8 +337,9 @@ inline bool countResolvents(const uint32& x, SCNF& scnf, OL& me, OL& other,
 				SCLAUSE& cj = scnf[*j];
 				if (cj.original()) {
 					int rsize;
-					if ((rsize = merge(x, ci, cj)) > 1) {
-						if (rlimit && rsize > rlimit) return false;
+					if ((rsize = merge(x, ci, cj))) {
+						// unit resolvents are left to self-subsumption
+						if (rsize == 1 || (rlimit && rsize > rlimit)) return false;
 						nAddedCls++;
 						nAddedLits += rsize;
 					}
@@ -365,8 +363,9 @@ inline bool countResolvents(const uint32& x, const int& clsbefore, SCNF& scnf, O
 				SCLAUSE& cj = scnf[*j];
 				if (cj.original()) {
 					int rsize;
-					if ((rsize = merge(x, ci, cj)) > 1) {
-						if (++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return false;
+					if ((rsize = merge(x, ci, cj))) {
+						// unit resolvents are left to self-subsumption
+						if (rsize == 1 || ++nAddedCls > clsbefore || (rlimit && rsize > rlimit)) return false;
 						nAddedLits += rsize;
 					}
 				}
@@ -382,43 +381,53 @@ inline bool countResolvents(const uint32& x, const int& clsbefore, SCNF& scnf, O
 	return true;
 }
 
-inline void toblivion(SCNF& scnf, OL& list)
+inline void toblivion(SCNF& scnf, OT& ot, const uint32& lit)
 {
+	OL& list = ot[lit];
 	forall_occurs(list, i) {
-		scnf[*i].markDeleted();
+		SCLAUSE& c = scnf[*i];
+		ot.touch(c);
+		c.markDeleted();
 	}
 	list.clear(true);
+	ot.touch(lit);
 }
 
-inline void toblivion(const uint32& p, OL& poss,
-					  const uint32& n, OL& negs, 
+inline void toblivion(const uint32& p, const uint32& n,
 					  const int& pOrgs, 
 					  const int& nOrgs, 
 					  SCNF& scnf, 
+					  OT& ot,
 					  MODEL& model)
 {
 	LOG2(4, " saving clauses of eliminated(%d) as witness", ABS(p));
 	if (pOrgs > nOrgs) {
+		OL& negs = ot[n];
 		forall_occurs(negs, i) {
 			SCLAUSE& c = scnf[*i];
 			if (c.original())
 				model.saveClause(c, c.size(), n);
+			ot.touch(c);
 			c.markDeleted();
 		}
 		model.saveWitness(p);
 		negs.clear(true);
-		toblivion(scnf, poss);
+		ot.touch(n);
+		toblivion(scnf, ot, p);
 	}
 	else {
+		OL& poss = ot[p];
 		forall_occurs(poss, i) {
 			SCLAUSE& c = scnf[*i];
 			if (c.original())
 				model.saveClause(c, c.size(), p);
+			ot.touch(c);
 			c.markDeleted();
 		}
 		model.saveWitness(n);
 		poss.clear(true);
-		toblivion(scnf, negs);
+		ot.touch(p);
+		toblivion(scnf, ot, n);
 	}
 }
 
@@ -23,11 +23,27 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "datatypes.hpp"
 #include "vector.hpp"
 #include "sclause.hpp"
+#include "heap.hpp"
+#include "key.hpp"
+#include "statistics.hpp"
 
 namespace SeqFROST {
 
-	constexpr int	 MAXFUNVAR = 12;
-	constexpr uint32 FUNTABLEN = 64;  // (1 << (12 - 6))
+	// core size of function tables is fixed at compile time
+	// with '-DFUNVARS=<n>' (default 12, at most 16 variables)
+	#ifndef FUNVARS
+	#define FUNVARS 12
+	#endif
+
+	template <int NVARS>
+	struct FUNCORE {
+		static_assert(NVARS >= 6 && NVARS <= 16, "function core must have 6 to 16 variables");
+		static constexpr int	vars = NVARS;
+		static constexpr uint32	words = 1U << (NVARS - 6); // one bit per assignment
+	};
+
+	constexpr int	 MAXFUNVAR = FUNCORE<FUNVARS>::vars;
+	constexpr uint32 FUNTABLEN = FUNCORE<FUNVARS>::words;
 
 	extern uint32 orgcore[MAXFUNVAR];
 
@@ -40,10 +56,140 @@ namespace SeqFROST {
 
 	typedef uint64				Fun[FUNTABLEN];
 	typedef uint64				S_REF;
-	typedef Vec<S_REF, int>		OL;
-	typedef Vec<OL>				OT;
 	typedef SMM<uint32, S_REF>	STYPE;
 	typedef Vec<S_REF>			cnf_refs_t;
+	typedef HEAP<ELIM_CMP>		esched_t;
+
+	/*****************************************************/
+	/*  Usage:   occurrence list as a window of 'OT'     */
+	/*  Dependency:  S_REF                               */
+	/*****************************************************/
+	class OL {
+
+		S_REF* _mem;
+		int sz, cap;
+
+	public:
+		__forceinline			OL			() : _mem(NULL), sz(0), cap(0) {}
+		__forceinline void		bind		(S_REF* mem, const int& capacity) { _mem = mem, cap = capacity; }
+		__forceinline			operator S_REF* () { return _mem; }
+		__forceinline S_REF*	data		() { return _mem; }
+		__forceinline S_REF*	end			() { return _mem + sz; }
+		__forceinline const S_REF& operator[] (const int& i) const { assert(i >= 0 && i < sz); return _mem[i]; }
+		__forceinline S_REF&	operator[]	(const int& i) { assert(i >= 0 && i < sz); return _mem[i]; }
+		__forceinline const S_REF& back		() const { assert(sz); return _mem[sz - 1]; }
+		__forceinline S_REF&	back		() { assert(sz); return _mem[sz - 1]; }
+		__forceinline bool		empty		() const { return !sz; }
+		__forceinline int		size		() const { return sz; }
+		__forceinline int		capacity	() const { return cap; }
+		__forceinline void		insert		(const S_REF& r) { assert(sz < cap); _mem[sz++] = r; }
+		__forceinline void		resize		(const int& n) { assert(n <= sz); sz = n; }
+		// memory is owned by 'OT' and reclaimed on the next layout
+		__forceinline void		clear		(const bool& _free = false) { sz = 0; }
+	};
+
+	// occurrence of 'ref' in 'lit' postponed to the next update
+	struct DEFERRED { S_REF ref; uint32 lit; };
+
+	// clause 'ref' equals the matched clause 'cls' with 'lit' in place of the BVA literal
+	struct BVAMATCH { S_REF ref; uint32 lit, cls; };
+
+	/*****************************************************/
+	/*  Usage:   occurrence table in compressed rows     */
+	/*  Dependency:  OL, Vec                             */
+	/*****************************************************/
+	class OT {
+
+		Vec<S_REF, size_t>	_pool;
+		Vec<OL>				_lists;
+		Vec<Byte>			_marks;
+		uVec1D				_touched;		// literals whose lists changed since the last sync
+		Vec<DEFERRED>		_deferred;
+
+		// move 'ol' to the pool tail with a doubled capacity
+		inline void			relocate	(OL& ol) {
+			const int newcap = ol.capacity() ? (ol.capacity() << 1) : 2;
+			const size_t offset = _pool.size();
+			if (offset + newcap > _pool.capacity()) {
+				// rebind all lists if the pool moves
+				S_REF* oldbase = _pool.data();
+				Vec<size_t> offsets(_lists.size());
+				for (uint32 i = 0; i < _lists.size(); ++i) {
+					if (_lists[i].capacity()) 
+						offsets[i] = size_t(_lists[i].data() - oldbase);
+				}
+				_pool.reserve((offset + newcap) << 1);
+				S_REF* newbase = _pool.data();
+				for (uint32 i = 0; i < _lists.size(); ++i) {
+					OL& list = _lists[i];
+					if (list.capacity()) list.bind(newbase + offsets[i], list.capacity());
+				}
+			}
+			_pool.expand(offset + newcap, 0);
+			S_REF* mem = _pool.data() + offset;
+			std::memcpy(mem, ol.data(), ol.size() * sizeof(S_REF));
+			ol.bind(mem, newcap);
+		}
+
+	public:
+		inline OL&			operator[]	(const uint32& lit) { return _lists[lit]; }
+		inline const OL&	operator[]	(const uint32& lit) const { return _lists[lit]; }
+		inline uint32		size		() const { return _lists.size(); }
+		inline size_t		memory		() const { return _pool.capacity() * sizeof(S_REF); }
+		inline uVec1D&		touched		() { return _touched; }
+		inline Vec<DEFERRED>& deferred	() { return _deferred; }
+		inline void			resize		(const uint32& n) { _lists.resize(n), _marks.resize(n, 0); }
+		inline void			expand		(const uint32& n) { _lists.expand(n), _marks.expand(n, 0); }
+		inline void			clear		(const bool& _free = false) { 
+			_lists.clear(_free), _pool.clear(_free);
+			_marks.clear(_free), _touched.clear(_free), _deferred.clear(_free);
+		}
+		inline void			touch		(const uint32& lit) {
+			if (!_marks[lit]) _touched.push(lit);
+			_marks[lit] = 2;
+		}
+		// resync a list whose order changed but not its clauses
+		inline void			reorder		(const uint32& lit) {
+			if (!_marks[lit]) { _marks[lit] = 1; _touched.push(lit); }
+		}
+		inline bool			changed		(const uint32& lit) const { return _marks[lit] > 1; }
+		inline void			touch		(SCLAUSE& c) {
+			forall_clause(c, k) { touch(*k); }
+		}
+		inline void			untouch		() {
+			forall_vector(uint32, _touched, i) { _marks[*i] = 0; }
+			_touched.clear();
+		}
+		inline void			defer		(const uint32& lit, const S_REF& r) { _deferred.push({ r, lit }); }
+		inline void			push		(const uint32& lit, const S_REF& r) {
+			OL& ol = _lists[lit];
+			if (ol.size() == ol.capacity()) relocate(ol);
+			ol.insert(r);
+		}
+		// lay out all lists contiguously with room for their current
+		// contents, 'counts[lit]' new refs and a quarter of slack
+		inline void			layout		(const uint32* counts) {
+			const uint32 nlists = _lists.size();
+			size_t total = 0;
+			for (uint32 i = 0; i < nlists; ++i) {
+				const size_t size = size_t(_lists[i].size()) + counts[i];
+				total += size + (size >> 2);
+			}
+			Vec<S_REF, size_t> pool;
+			pool.expand(total, 0);
+			S_REF* mem = pool.data();
+			for (uint32 i = 0; i < nlists; ++i) {
+				OL& list = _lists[i];
+				const size_t size = size_t(list.size()) + counts[i];
+				const int cap = int(size + (size >> 2));
+				if (list.size()) std::memcpy(mem, list.data(), list.size() * sizeof(S_REF));
+				list.bind(mem, cap);
+				mem += cap;
+			}
+			assert(mem == pool.end());
+			pool.migrateTo(_pool);
+		}
+	};
 
 	class SCNF : public STYPE {
 
@@ -125,6 +271,34 @@ namespace SeqFROST {
 		}
 	};
 
+	// elimination decided for an elected variable
+	struct VEPLAN {
+		uint32 first;			// resolvents offset in the worker buffer
+		uint32 def;				// definition of a buffer/inverter gate
+		uint32 worker;
+		int pOrgs, nOrgs;
+		int nAddedCls, nAddedLits;
+		Byte type;
+	};
+
+	// thread-local buffers for planning eliminations
+	struct VEWORKER {
+		Lits_t out_c;
+		uVec1D resolvents;		// each resolvent is stored as (size, literals)
+		BVESTATS stats;
+		VEWORKER() { RESETSTRUCT(&stats); }
+	};
+
+	// proof, unit and deletion records of (self)-subsumption
+	struct SUBWORKER {
+		uVec1D log;				// each record is stored as (operation, size, literals)
+		SUBSTATS stats;
+		SUBWORKER() { RESETSTRUCT(&stats); }
+	};
+
+	// log range written by a worker for a chunk of elected variables
+	struct WORKSPAN { uint32 worker, first, last; };
+
 	#define forall_occurs(LIST, PTR) \
 		for (S_REF* PTR = LIST, *END = LIST.end(); PTR != END; ++PTR)
 
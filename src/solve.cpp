@@ -33,10 +33,13 @@ Solver::Solver(const string& path) :
 	, vsidsheap(ACTIV_CMP(vsids.scores))
 	, chbheap(ACTIV_CMP(chb.scores))
 	, vschedule(SCORS_CMP(wot))
+	, eschedule(ELIM_CMP(elimcosts))
 	, bumped(0)
 	, conflict(UNDEF_REF)
 	, ignore(UNDEF_REF)
 	, decisionlevel(0)
+	, savedpos(0)
+	, ntouched(0)
 	, decheuristic(0)
 	, interrupted(false)
 	, incremental(false)
@@ -66,6 +69,7 @@ void Solver::allocSolver()
 	trail.reserve(inf.maxVar);
 	dlevel.reserve(inf.maxVar);
 	bumps.resize(maxSize, 0);
+	vtouched.resize(maxSize, 0);
 	vsids.scores.resize(maxSize, 0);
 	chb.conflicts.resize(maxSize);
 	chb.scores.resize(maxSize, 0.0);
@@ -159,9 +163,11 @@ void Solver::solve()
 	initLimits();
 	if (verbose == 1) printTable();
 	if (canPreSimplify()) simplify();
+	// units of the XOR matrix may solve the formula before search
+	if (UNSOLVED) buildGauss();
 	if (UNSOLVED) {
 		LOG2(2, "-- CDCL search started..");
-		MDMInit();
+		if (inf.unassigned) MDMInit();
 		while (UNSOLVED && !EXHAUSTED) {
 			if (BCP()) analyze();
 			else if (!inf.unassigned) SET_SAT;
@@ -203,5 +209,11 @@ void Solver::wrapup()
 	else if (UNSOLVED) 
 		LOGSAT("UNKNOWN");
 	if (opts.proof_en) proof.close();
+#ifdef PROFILING
+	profiler.write(opts.profile_path);
+#endif
+#ifdef STATISTICS
+	if (*opts.analysis_path) writeAnalysis(opts.analysis_path);
+#endif
 	if (opts.report_en) report();
 }
\ No newline at end of file
@@ -21,7 +21,11 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "map.hpp"
 #include "walk.hpp"
+#include "gauss.hpp"
+#include "cardinality.hpp"
+#include "congruence.hpp"
 #include "heap.hpp"
+#include "hash.hpp"
 #include "queue.hpp"
 #include "model.hpp"
 #include "proof.hpp"
@@ -37,6 +41,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "statistics.hpp"
 #include "heuristics.hpp"
 #include "minimizeall.hpp"
+#include "propprofile.hpp"
 
 namespace SeqFROST {
 
@@ -86,6 +91,7 @@ namespace SeqFROST {
 		BCNF			orgs;
 		BCNF			learnts;
 		BCNF			reduced;
+		CHASH			chash;
 		CLAUSE			subbin;
 		MAB				mab;
 		CHB				chb;
@@ -97,36 +103,50 @@ namespace SeqFROST {
 		dheap_t			vsidsheap;
 		dheap_t			chbheap;
 		dlevel_t		dlevel;
+		savedtrail_t	savedtrail;
 		vsched_t		vschedule;
 		csched_t		scheduled;
 		Vec<OCCUR>		occurs;
+		uVec1D			elimcosts;	// costs at which variables were last scheduled for VE
+		esched_t		eschedule;
 		Vec<DWATCH>		dwatches;
 		Vec<WOL>		wot;
+		CHASH			thash;	// binaries and ternaries of 'wot' by their literals
 		Vec<BOL>		bot;	
+		Vec<FOL>		fot;
 		uVec1D			lbdlevels;
 		uVec1D			eligible;
 		uVec1D			probes;
 		uVec1D			trail;
 		uVec1D			vorg;
 		uVec1D			vhist;
+		Vec<Byte>		vtouched;
 		uVec1D			analyzed;
 		uVec1D			minimized;
+		Vec<MINFRAME>	minstack;
 		uVec1D			shrinkable;
 		LBDREST			lbdrest;
 		LUBYREST		lubyrest;
 		RANDOM			random;
 		WALK			tracker;
+		GAUSS			gauss;
+		CARDS			cards;
 		uint64			bumped;
 		C_REF			conflict;
 		C_REF			ignore;
 		size_t			tablerowlen;
 		string			tablerow;
 		uint32			decisionlevel;
+		uint32			savedpos;
+		uint32			ntouched;
 		int				decheuristic;
 		bool			interrupted;
 		bool			incremental;
 		bool			stable;
 		bool			probed;
+#ifdef PROFILING
+		PROPPROFILE		profiler;
+#endif
 
 	public:
 
@@ -154,9 +174,12 @@ namespace SeqFROST {
 		inline void		MDMAssume			(const LIT_ST* values, const cbucket_t* cs, LIT_ST* frozen, uint32*& tail);
 		inline bool		valid				(const LIT_ST* values, const cbucket_t* cs, WL& ws);
 		inline void		recycleWL			(const uint32& lit, const cbucket_t* cs, const bool* deleted);
-		inline bool		findBinary			(uint32 first, uint32 second, const cbucket_t* cs);
-		inline bool		findTernary			(uint32 first, uint32 second, uint32 third, const cbucket_t* cs);
+		inline bool		findBinary			(const uint32& first, const uint32& second, const cbucket_t* cs);
+		inline bool		findTernary			(const uint32& first, const uint32& second, const uint32& third, const cbucket_t* cs);
 		inline void		minimizeBlock		(LEARNTLIT* bbegin, const LEARNTLIT* bend, const uint32& level, const uint32& uip);
+		inline int		minimizeLit			(const uint32& lit, const int& depth);
+		inline bool		sameClause			(const C_REF& ref, const int& size);
+		inline bool		reuseDuplicate		(const C_REF& dref);
 		inline void		analyzeBlock		(LEARNTLIT* bbegin, const LEARNTLIT* bend, const uint32& level, const uint32& maxtrail);
 		inline int		analyzeLit			(const uint32& level, const uint32& lit);
 		inline void		analyzeLit			(const uint32& lit, int& track, int& size);
@@ -171,6 +194,7 @@ namespace SeqFROST {
 		inline void		cancelAssign		(const uint32& lit);
 		inline void		cancelAutark		(const bool& add, const uint32& lit, LIT_ST* autarkies);
 		inline bool		canDecompose		(const bool& first);
+		inline bool		canCongruence		();
 		inline void		pumpFrozenHeap		(const uint32& lit);
 		inline void		pumpFrozenQue		(const uint32& lit);
 		inline void		bumpReason			(const uint32& lit);
@@ -188,6 +212,8 @@ namespace SeqFROST {
 		inline int		calcLBD				();
 		inline bool		canVivify			();
 		inline uint32	nextProbe			();
+		inline void		leaveProbe			(const Vec<PROBENODE>&, uVec1D&);
+		inline int		decideProbe			(const Vec<PROBENODE>&, uVec1D&, const uint32&, uint32*, uint32&);
 		inline void		nointerrupt			() { 
 			interrupted = false;
 		}
@@ -518,7 +544,27 @@ namespace SeqFROST {
 		C_REF			addClause			(const Lits_t& src, const bool& learnt);
 		void			addClause			(const C_REF& cref, CLAUSE& c, const bool& learnt);
 		bool			makeClause			(Lits_t& c, Lits_t& org, char*& str);
+		C_REF			findDuplicate		(const uint32* lits, const int& size, const uint64& key, const C_REF& self = UNDEF_REF);
+		void			hashClauses			(BCNF& cnf);
+		void			hashClauses			();
 		void			backtrack			(const uint32& jmplevel = 0);
+		inline void		restoreTrail		();
+		inline C_REF	gaussClause			(const uint32& r, const uint32& implied);
+		inline bool		checkGauss			(const uint32& r);
+		inline bool		pivotGauss			(const uint32& r, const uint32& col);
+		inline bool		watchGauss			(const uint32& col);
+		inline CLAUSE&	explain				(const C_REF& ref, const uint32& implied) {
+			return CARDREASON(ref) ? cards.explain(ref, implied) : cm[ref];
+		}
+		inline void		clearSavedTrail		() { savedtrail.clear(), savedpos = 0; }
+		inline void		touchVar			(const uint32& v) {
+			CHECKVAR(v);
+			if (!vtouched[v]) vtouched[v] = 1, ntouched++;
+		}
+		inline void		clearTouched		() {
+			vtouched.resize(inf.maxVar + 1, 0);
+			ntouched = 0;
+		}
 		void			map					(const bool& sigmified = false);
 		void			recycle				(CMM& new_cm);
 		void			recycleWT			(const cbucket_t* cs, const bool* deleted);
@@ -535,6 +581,11 @@ namespace SeqFROST {
 		void			attachNonBins		(BCNF& cnf, const cbucket_t* cs, const bool* deleted, const bool& hasElim = false);
 		void			attachClauses		(BCNF& cnf, const cbucket_t* cs, const bool* deleted, const bool& hasElim = false);
 		bool			substitute			(BCNF& cnf, uint32* smallests);
+		bool			applySubstitution	(uint32* smallests, const uint32& substituted);
+		uint32			extractXORs			(uVec1D& xors, const int& maxarity, const uint32& maxrows);
+		inline void		extractGates		(Vec<GATE>& gates, uVec1D& inputs);
+		inline bool		normalizeGate		(GATE& g, uVec1D& inputs, EQUIVS& equivs);
+		inline bool		hasTernary			(Vec<BCNF>& occs, const uint32& a, const uint32& b, const uint32& c);
 		void			attachTernary		(BCNF& cnf, LIT_ST* use, const cbucket_t* cs, const bool* deleted);
 		void			scheduleTernary		(LIT_ST* use);
 		uint32			autarkReasoning		(LIT_ST* autarkies);
@@ -552,12 +603,13 @@ namespace SeqFROST {
 		void			detachClauses		(const bool& keepbinaries);
 		void			decompose			(const bool& first);
 		void			shrinkTop			(const bool& conditional);
-		void			newHyper3			(const bool& learnt);
+		C_REF			newHyper3			(const bool& learnt);
 		uint32			nextHeap			(dheap_t& heap);
 		uint32			nextQueue			();
 		void			newHyper2			();
 		bool			shrink				();
 		bool			decompose			();
+		void			congruence			();
 		void			debinary			();
 		void			ternary				();
 		void			transitive			();
@@ -591,6 +643,8 @@ namespace SeqFROST {
 		void			probe				();
 		void			failing				();
 		void			scheduleProbes		();
+		void			treeProbes			(Vec<PROBENODE>&);
+		void			probeTree			(const Vec<PROBENODE>&, const uint64&, uint32&, uint32&);
 		uint32			reuse				();
 		C_REF			learn				();
 		void			analyze				();
@@ -600,10 +654,18 @@ namespace SeqFROST {
 		bool			BCPVivify			();
 		bool			BCPProbe			();
 		bool			BCP					();
+		bool			propGauss			();
+		bool			propCards			(const uint32& lit);
+		void			shrinkCards			();
+		void			extractCards		();
+		void			expandCards			(const uint32* smallests);
+		void			removeGaussReasons	();
+		void			buildGauss			();
 		void			MDMInit				();
 		void			MDM					();
 		void			decide				();
 		void			report				();
+		void			writeAnalysis		(const char*);
 		void			wrapup				();
 		bool			parser				();
 		void			solve				();
@@ -615,6 +677,10 @@ namespace SeqFROST {
 		uVec1D	elected;
 		SCNF	scnf;
 		OT		ot;
+		uint32	indexed;	// 'scnf' clauses inserted in 'ot'
+		Vec<Byte>	nogate;	// variables VE failed on since their lists last changed
+		Vec<Byte>	noblocked;	// variables BCE found nothing on since their lists last changed
+		CHASH		witnesses;	// last clause making a BCE candidate not blocked
 		uint32	multiplier;
 		int		phase;
 		int		numforced;
@@ -623,10 +689,13 @@ namespace SeqFROST {
 
 	public:
 
-		inline void		resizeCNF			() {
+		inline bool		resizeCNF			() {
 			int times = phase + 1;
-			if (times > 1 && times != opts.phases && (times % opts.collect_freq) == 0)
+			if (times > 1 && times != opts.phases && (times % opts.collect_freq) == 0) {
 				shrinkSimp();
+				return true;
+			}
+			return false;
 		}
 		inline void		initSimp			() {
 			phase = multiplier = numforced = 0;
@@ -735,29 +804,51 @@ namespace SeqFROST {
 			c.set_usage(USAGET3);
 			LOGCLAUSE(4, c, " Bumping shrunken clause with (lbd:%d, usage:%d) ", new_lbd, c.usage());
 		}
-		inline void		addResolvent		(const Lits_t& resolvent, const S_REF& ref);
-		inline void		resolve				(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits);
-		inline void		resolveCore			(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits);
-		inline void		substitute			(const uint32& x, Lits_t& out_c, const int& nAddedCls, const int& nAddedLits);
+		inline void		addResolvent		(const uint32* resolvent, const int& size, const S_REF& ref);
+		inline void		addResolvents		(const VEPLAN& plan, VEWORKER& worker);
+		inline void		saveResolvent		(VEWORKER& worker);
+		inline void		resolve				(const uint32& x, VEWORKER& worker, const int& nAddedCls);
+		inline void		resolveCore			(const uint32& x, VEWORKER& worker, const int& nAddedCls);
+		inline void		substitute			(const uint32& x, VEWORKER& worker, const int& nAddedCls);
 		inline bool		propClause			(const LIT_ST* values, const uint32& lit, SCLAUSE& c);
 		inline bool		depFreeze			(OL& ol, OCCUR* occs, LIT_ST* frozen, uint32*& tail, const uint32& cand, const uint32& pmax, const uint32& nmax);
 		inline bool		checkMem			(const string& name, const size_t& size);
 		void			strengthen			(SCLAUSE& c, const uint32& me);
+		void			strengthen			(SCLAUSE& c, const uint32& me, uVec1D& log);
+		void			replaySub			(uVec1D& log, const uint32& first, const uint32& last);
 		void			extract				(BCNF& cnf);
-		void			histCNF				(SCNF& cnf, const bool& reset = false);
 		void			reduceOL			(OL& ol);
+		void			syncOL				(OL& ol);
 		void			createOT			(const bool& reset = true);
+		void			updateOT			();
+		void			indexOT				();
+		void			syncOT				();
+		inline void		countOT				(const uint32& begin, const uint32& end, uVec1D& counts);
+		inline void		fillOT				(const uint32& begin, const uint32& end);
 		void			newBeginning		();
 		void			shrinkSimp			();
 		void			simplifying			();
 		void			simplify			();
 		void			awaken				();
 		bool			LCVE				();
+		void			electVE				();
+		bool			reelectVE			(uVec1D& survivors);
+		void			keepElected			(uVec1D& survivors);
+		inline void		scheduleVE			();
+		void			rescheduleVE		(const uint32& v);
 		bool			prop				();
 		void			VE					();
+		void			planVE				(const uint32& v, const uint32& tid, VEWORKER& worker, VEPLAN& plan);
+		void			applyVE				(const uint32& v, const VEPLAN& plan, VEWORKER& worker);
 		void			SUB					();
 		void			ERE					();
+		void			hashERE				(CHASH& table, const int& maxsize);
 		void			BCE					();
+		void			BVA					();
+		void			AMO					();
+		uint32			freshVar			();
+		inline uint32	replaceBVA			(const uint32& lit, uVec1D& mlits, Vec<S_REF>& mcls, Vec<S_REF>& matched, Lits_t& clause);
+		inline void		matchBVA			(const uint32& lit, const uint32& cls, const S_REF& cref, uVec1D& mlits, Vec<BVAMATCH>& matches, int64& ticks);
 		void			sortOT				();
 		void			reduceOT			();
 
@@ -28,10 +28,13 @@ Solver::Solver() :
 	, vsidsheap(ACTIV_CMP(vsids.scores))
 	, chbheap(ACTIV_CMP(chb.scores))
 	, vschedule(SCORS_CMP(wot))
+	, eschedule(ELIM_CMP(elimcosts))
 	, bumped(0)
 	, conflict(UNDEF_REF)
 	, ignore(UNDEF_REF)
 	, decisionlevel(0)
+	, savedpos(0)
+	, ntouched(0)
 	, decheuristic(0)
 	, interrupted(false)
 	, incremental(true)
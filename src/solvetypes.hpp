@@ -33,6 +33,14 @@ namespace SeqFROST {
     typedef Vec<uint32>         BOL;
     typedef Vec<C_REF>          WOL;
 
+    // clause watched by one literal for forward subsumption
+    // with a signature of its variables to skip non-candidates
+    struct FWATCH {
+        C_REF ref;
+        uint64 sig;
+    };
+    typedef Vec<FWATCH>         FOL;
+
     struct SCORS_CMP {
         const Vec<WOL>& wot;
         SCORS_CMP(const Vec<WOL>& wot) : wot(wot) { }
@@ -46,6 +54,30 @@ namespace SeqFROST {
         inline CSIZE(const C_REF& ref, const uint32& size) : ref(ref), size(size) { }
     };
 
+    // a probe implying its 'parent' through the binary 'edge',
+    // where 'end' is the index past its subtree in depth-first order
+    struct PROBENODE {
+        C_REF edge;
+        uint32 lit, parent, end;
+        inline PROBENODE() : edge(UNDEF_REF), lit(0), parent(UINT32_MAX), end(0) {}
+        inline PROBENODE(const uint32& lit, const uint32& parent, const C_REF& edge) : 
+            edge(edge), lit(lit), parent(parent), end(0) { }
+    };
+
+    struct SAVED {
+        C_REF ref;
+        uint32 lit;
+        inline SAVED() : ref(UNDEF_REF), lit(0) {}
+        inline SAVED(const uint32& lit, const C_REF& ref) : ref(ref), lit(lit) { }
+    };
+
+    struct MINFRAME {
+        uint32 lit;
+        int idx;
+        inline MINFRAME() : lit(0), idx(0) {}
+        inline MINFRAME(const uint32& lit) : lit(lit), idx(0) { }
+    };
+
     struct DFS {
         uint32 idx, min;
         inline DFS() : idx(0), min(0) { }
@@ -113,6 +145,7 @@ namespace SeqFROST {
     };
 
     typedef Vec<C_REF>          BCNF;
+    typedef Vec<SAVED>          savedtrail_t;
     typedef Vec<CSIZE, C_REF>   csched_t;
     typedef HEAP<SCORS_CMP>     vsched_t;
 
@@ -122,6 +155,9 @@ namespace SeqFROST {
     #define forall_wol(WLIST, PTR) \
 		for (C_REF* PTR = WLIST, *END = WLIST.end(); PTR != END; ++PTR)
 
+    #define forall_fol(FLIST, PTR) \
+		for (FWATCH* PTR = FLIST, *END = FLIST.end(); PTR != END; ++PTR)
+
     #define PREFETCH_CS(CS) \
         const cbucket_t* CS = cm.address(0); \
 
@@ -158,6 +158,29 @@ namespace SeqFROST {
 				state[v] = src->state[v];
 			}
 		}
+		// copy all arrays and scalers of 'src' up to the smaller size
+		void	copyAll		(const SP* src)
+		{
+			const size_t n = MIN(_sz, src->_sz);
+			std::memcpy(source, src->source, n * sizeof(C_REF));
+			std::memcpy(level, src->level, n * sizeof(uint32));
+			std::memcpy(board, src->board, n * sizeof(uint32));
+			std::memcpy(trailpos, src->trailpos, n * sizeof(uint32));
+			std::memcpy(tmpstack, src->tmpstack, n * sizeof(uint32));
+			std::memcpy(value, src->value, n + n);
+			std::memcpy(marks, src->marks, n);
+			std::memcpy(frozen, src->frozen, n);
+			std::memcpy(seen, src->seen, n);
+			std::memcpy(state, src->state, n * sizeof(State_t));
+			std::memcpy(phase, src->phase, n * sizeof(Phase_t));
+			stacktail = src->stacktail ? tmpstack + (src->stacktail - src->tmpstack) : NULL;
+			learntLBD = src->learntLBD;
+			reasonsize = src->reasonsize, resolventsize = src->resolventsize;
+			conflictdepth = src->conflictdepth, conflictsize = src->conflictsize;
+			trailpivot = src->trailpivot;
+			simplified = src->simplified;
+			propagated = src->propagated;
+		}
 		void	printStates	() {
 			LOGN1(" States->[");
 			forall_space(v) {
@@ -36,12 +36,15 @@ void Solver::report()
 				LOG1(" %s - OT  creation          : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.cot, CNORMAL);
 				LOG1(" %s - OT  sorting           : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.sot, CNORMAL);
 				LOG1(" %s - OT  reduction         : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.rot, CNORMAL);
-				LOG1(" %s - BVE                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.ve, CNORMAL);
-				LOG1(" %s - HSE                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.sub, CNORMAL);
-				LOG1(" %s - BCE                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.bce, CNORMAL);
-				LOG1(" %s - ERE                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.ere, CNORMAL);
+				LOG1(" %s - BVE                   : %s%-16.2f  ms (%lld ticks)%s", CREPORT, CREPORTVAL, timer.ve, stats.simplify.ticks.ve, CNORMAL);
+				LOG1(" %s - HSE                   : %s%-16.2f  ms (%lld ticks)%s", CREPORT, CREPORTVAL, timer.sub, stats.simplify.ticks.sub, CNORMAL);
+				LOG1(" %s - BCE                   : %s%-16.2f  ms (%lld ticks)%s", CREPORT, CREPORTVAL, timer.bce, stats.simplify.ticks.bce, CNORMAL);
+				LOG1(" %s - ERE                   : %s%-16.2f  ms (%lld ticks)%s", CREPORT, CREPORTVAL, timer.ere, stats.simplify.ticks.ere, CNORMAL);
+				LOG1(" %s - BVA                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.bva, CNORMAL);
+				LOG1(" %s - AMO                   : %s%-16.2f  ms%s", CREPORT, CREPORTVAL, timer.amo, CNORMAL);
 			}
 			LOG1(" %sSimplification calls     : %s%-10d%s", CREPORT, CREPORTVAL, stats.simplify.calls, CNORMAL);
+			LOG1(" %s Extra VE rounds         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.rounds, CNORMAL);
 #ifdef STATISTICS
 			LOG1(" %s Removed variables       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.all.variables + stats.units.forced, CNORMAL);
 			LOG1(" %s  Resolutions            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bve.resolutions, CNORMAL);
@@ -52,15 +55,21 @@ void Solver::report()
 			LOG1(" %s  AND-OR                 : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bve.andors, CNORMAL);
 			LOG1(" %s  Fun                    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bve.funs, CNORMAL);
 			LOG1(" %s  XOR                    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bve.xors, CNORMAL);
+			LOG1(" %s  Skipped (no change)    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bve.skipped, CNORMAL);
 			LOG1(" %s Removed clauses         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.all.clauses, CNORMAL);
 			LOG1(" %s  Subsumed               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.sub.subsumed, CNORMAL);
 			LOG1(" %s  Strengthened           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.sub.strengthened, CNORMAL);
+			LOG1(" %s  Blocked                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bce.blocked, CNORMAL);
+			LOG1(" %s   Skipped (no change)   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bce.skipped, CNORMAL);
+			LOG1(" %s   Cached witnesses      : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bce.cached, CNORMAL);
 			LOG1(" %s Tried redundancies      : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.ere.tried, CNORMAL);
 			LOG1(" %s  Original removed       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.ere.orgremoved, CNORMAL);
 			LOG1(" %s  Original strengthened  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.ere.orgstrengthened, CNORMAL);
 			LOG1(" %s  Learnt removed         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.ere.learntremoved, CNORMAL);
 			LOG1(" %s  Learnt strengthened    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.ere.learntstrengthened, CNORMAL);
 			LOG1(" %s Removed literals        : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.all.literals, CNORMAL);
+			LOG1(" %s Added variables         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bva.variables, CNORMAL);
+			LOG1(" %s  Replaced clauses       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.bva.clauses, CNORMAL);
 #else
 			LOG1(" %sRemoved variables       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.simplify.all.variables + stats.units.forced, CNORMAL);
 			LOG1(" %s Forced units           : %s%-10d%s", CREPORT, CREPORTVAL, stats.units.forced, CNORMAL);
@@ -77,6 +86,7 @@ void Solver::report()
 		LOG1(" %s Binaries                : %s%-10d%s", CREPORT, CREPORTVAL, formula.binaries, CNORMAL);
 		LOG1(" %s Ternaries               : %s%-10d%s", CREPORT, CREPORTVAL, formula.ternaries, CNORMAL);
 		LOG1(" %s Larger                  : %s%-10d%s", CREPORT, CREPORTVAL, formula.large, CNORMAL);
+		LOG1(" %s Duplicates              : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.original, CNORMAL);
 		LOG1(" %s Max clause size         : %s%-10d%s", CREPORT, CREPORTVAL, formula.maxClauseSize, CNORMAL);
 		LOG1(" %s C2V ratio               : %s%-10.3f%s", CREPORT, CREPORTVAL, formula.c2v, CNORMAL);
 		if (opts.proof_en)
@@ -87,6 +97,8 @@ void Solver::report()
 		LOG1(" %s Chronological           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.backtrack.chrono, CNORMAL);
 		LOG1(" %s Non-Chronological       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.backtrack.nonchrono, CNORMAL);
 		LOG1(" %s Trail reuses            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.reuses, CNORMAL);
+		LOG1(" %s Trail saved             : %s%-16lld%s", CREPORT, CREPORTVAL, stats.trailsave.saved, CNORMAL);
+		LOG1(" %s Trail restored          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.trailsave.restored, CNORMAL);
 		LOG1(" %sConflicts                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.conflicts, CNORMAL);
 		LOG1(" %s OTF strengthened        : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.strengthenedfly, CNORMAL);
 		LOG1(" %s OTF subsumed            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.subsumedfly, CNORMAL);
@@ -94,11 +106,24 @@ void Solver::report()
 		LOG1(" %s Learnt OTF subsumed     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.learntfly, CNORMAL);
 		LOG1(" %s Learnt units            : %s%-10d%s", CREPORT, CREPORTVAL, stats.units.learnt, CNORMAL);
 		LOG1(" %s Learnt literals         : %s%-16lld%s", CREPORT, CREPORTVAL, LEARNTLITERALS, CNORMAL);
+		LOG1(" %s Learnt duplicates       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.learnt, CNORMAL);
+		LOG1(" %s Reused duplicates       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.reused, CNORMAL);
 		LOG1(" %s VMTF bumps              : %s%lld  (%0.3f %%)%s", CREPORT, CREPORTVAL, bumped, percent(double(bumped), double(UINT64_MAX)), CNORMAL);
 		LOG1(" %s Alluip shrunken         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.alluip.shrunken, CNORMAL);
 #ifdef STATISTICS
 		LOG1(" %s Minimized literals      : %s%2.2f %%%s", CREPORT, CREPORTVAL, percent((double)stats.minimize.before - stats.minimize.after, (double)stats.minimize.before), CNORMAL);
 #endif
+		LOG1(" %sGauss-Jordan calls       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.calls, CNORMAL);
+		LOG1(" %s XORs                    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.xors, CNORMAL);
+		LOG1(" %s Units                   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.units, CNORMAL);
+		LOG1(" %s Pivots                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.pivots, CNORMAL);
+		LOG1(" %s Propagations            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.propagations, CNORMAL);
+		LOG1(" %s Conflicts               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.gauss.conflicts, CNORMAL);
+		LOG1(" %sAt-most-one calls        : %s%-16lld%s", CREPORT, CREPORTVAL, stats.amo.calls, CNORMAL);
+		LOG1(" %s Constraints             : %s%-16lld%s", CREPORT, CREPORTVAL, stats.amo.constraints, CNORMAL);
+		LOG1(" %s Replaced binaries       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.amo.binaries, CNORMAL);
+		LOG1(" %s Propagations            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.amo.propagations, CNORMAL);
+		LOG1(" %s Conflicts               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.amo.conflicts, CNORMAL);
 		LOG1(" %sDeduplications           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.calls, CNORMAL);
 		LOG1(" %s Hyper unaries           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.hyperunary, CNORMAL);
 		LOG1(" %s Duplicated binaries     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.binaries, CNORMAL);
@@ -107,9 +132,16 @@ void Solver::report()
 		LOG1(" %s Hyper unaries           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.hyperunary, CNORMAL);
 		LOG1(" %s Removed variables       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.variables, CNORMAL);
 		LOG1(" %s Removed clauses         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.clauses, CNORMAL);
+		LOG1(" %sCongruence calls         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.congruence.calls, CNORMAL);
+		LOG1(" %s AND gates               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.congruence.ands, CNORMAL);
+		LOG1(" %s ITE gates               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.congruence.ites, CNORMAL);
+		LOG1(" %s XOR gates               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.congruence.xors, CNORMAL);
+		LOG1(" %s Removed variables       : %s%-16lld%s", CREPORT, CREPORTVAL, stats.congruence.variables, CNORMAL);
 		LOG1(" %sForward calls            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.calls, CNORMAL);
 		LOG1(" %s Checks                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.checks, CNORMAL);
+		LOG1(" %s Filtered by signature   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.filtered, CNORMAL);
 		LOG1(" %s Subsumed                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.subsumed, CNORMAL);
+		LOG1(" %s Duplicates              : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.forward, CNORMAL);
 		LOG1(" %s Strengthened            : %s%-16lld%s", CREPORT, CREPORTVAL, stats.forward.strengthened, CNORMAL);
 		LOG1(" %sHyper binary resolves    : %s%-16lld%s", CREPORT, CREPORTVAL, stats.binary.resolutions, CNORMAL);
 		LOG1(" %s Added binaries          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.binary.resolvents, CNORMAL);
@@ -145,6 +177,7 @@ void Solver::report()
 		LOG1(" %s Rounds                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.rounds, CNORMAL);
 		LOG1(" %s Probed                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.probed, CNORMAL);
 		LOG1(" %s Failed                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.failed, CNORMAL);
+		LOG1(" %s Stacked                 : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.stacked, CNORMAL);
 		LOG1(" %s Ticks                   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probeticks, CNORMAL);
 		LOG1(" %sTransitive calls         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.calls, CNORMAL);
 		LOG1(" %s Probed                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.transitive.probed, CNORMAL);
@@ -188,5 +221,39 @@ void Solver::report()
 		LOG1(" %s Minimum                 : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.minimum, CNORMAL);
 		LOG1(" %s Flipped                 : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.flipped, CNORMAL);
 		LOG1(" %s Improved                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.improved, CNORMAL);
+#ifdef STATISTICS
+		LOG1("\t\t\t%sConflict Analysis%s", CREPORT, CNORMAL);
+		stats.analysis.finduip.report("First-UIP (ns)");
+		stats.analysis.minimize.report("Minimize (ns)");
+		stats.analysis.minimizeall.report("Minimize-all (ns)");
+		stats.analysis.minimizebin.report("Minimize-binary (ns)");
+		stats.analysis.learn.report("Learn (ns)");
+		stats.analysis.backtrack.report("Backtrack (ns)");
+		stats.analysis.before.report("Learnt size (1st-UIP)");
+		stats.analysis.after.report("Learnt size (minimized)");
+		stats.analysis.lbd.report("Learnt LBD");
+#endif
+#ifdef PROFILING
+		profiler.report();
+#endif
 	}
+}
+
+void Solver::writeAnalysis(const char* path)
+{
+#ifdef STATISTICS
+	FILE* file = fopen(path, "w");
+	if (file == NULL) { LOGERRN("cannot open analysis file %s", path); return; }
+	fprintf(file, "histogram,range,count\n");
+	stats.analysis.finduip.write(file, "finduip");
+	stats.analysis.minimize.write(file, "minimize");
+	stats.analysis.minimizeall.write(file, "minimizeall");
+	stats.analysis.minimizebin.write(file, "minimizebin");
+	stats.analysis.learn.write(file, "learn");
+	stats.analysis.backtrack.write(file, "backtrack");
+	stats.analysis.before.write(file, "sizebefore");
+	stats.analysis.after.write(file, "sizeafter");
+	stats.analysis.lbd.write(file, "lbd");
+	fclose(file);
+#endif
 }
\ No newline at end of file
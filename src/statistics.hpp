@@ -20,6 +20,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __STATS_
 
 #include "datatypes.hpp"
+#include "loghist.hpp"
+#include "timer.hpp"
 #include <cassert>
 #include <cstring>
 
@@ -32,6 +34,11 @@ namespace SeqFROST {
 	struct BVESTATS { 
 		uint64 pures, resolutions;
 		uint64 inverters, andors, ites, xors, funs;
+		uint64 skipped;
+	};
+
+	struct BCESTATS {
+		uint64 blocked, skipped, cached;
 	};
 
 	struct ERESTATS { 
@@ -39,11 +46,21 @@ namespace SeqFROST {
 		uint64 orgstrengthened, learntstrengthened; 
 	};
 
+	struct BVASTATS {
+		uint64 variables, clauses;
+	};
+
 	struct SIGMASTATS {
 		uint32 calls;
+		uint64 rounds;
+		struct {
+			uint64 ve, sub, bce, ere;
+		} ticks;
 		BVESTATS bve;
 		SUBSTATS sub;
+		BCESTATS bce;
 		ERESTATS ere;
+		BVASTATS bva;
 		struct { 
 			uint64 variables, clauses; 
 			int64 literals; 
@@ -71,26 +88,39 @@ namespace SeqFROST {
 		struct { uint32 learnt, forced; } units;
 		struct { uint64 original, learnt; } clauses, literals;
 		struct { uint64 chrono, nonchrono; } backtrack;
+		struct { uint64 saved, restored; } trailsave;
+		struct { uint64 calls, xors, units, pivots, propagations, conflicts; } gauss;
+		struct { uint64 calls, constraints, binaries, propagations, conflicts; } amo;
+		struct { uint64 original, learnt, reused, forward; } duplicates;
 		struct { uint64 calls, eliminated; } autarky;
 		struct { uint64 probed, failed, removed; } transitive;
 		struct { uint64 calls, clauses, literals; } shrink;
 		struct { uint64 single, multiple, massumed; } decisions;
 		struct { uint64 calls, binaries, hyperunary; } debinary;
-		struct { uint64 calls, rounds, failed, probed; } probe;
+		struct { uint64 calls, rounds, failed, probed, stacked; } probe;
 		struct { uint32 calls, vmtf, vsids, chb, walks; } mdm;
 		struct { uint64 resolutions, resolvents, reduced; } binary;
 		struct { uint64 all, random, best, inv, org, flip; } rephase;
 		struct { uint64 calls, scc, variables, hyperunary, clauses; } decompose;
+		struct { uint64 calls, ands, ites, xors, variables; } congruence;
 		struct { 
 			uint64 calls, checks;
 			uint64 minimum, flipped, improved;
 		} walk;
+#ifdef STATISTICS
+		struct {
+			LOGHIST finduip, minimize, minimizeall, minimizebin;
+			LOGHIST learn, backtrack;	// latencies in nanoseconds
+			LOGHIST before, after, lbd;	// learnt clause size before/after minimization
+			uint64 backtracking;		// backtrack latency of the last learn
+		} analysis;
+#endif
 		struct {
 			uint64 checks, calls;
 			uint64 resolutions, binaries, ternaries, reduced;
 		} ternary;
 		struct {
-			uint64 checks, leftovers, calls;
+			uint64 checks, filtered, leftovers, calls;
 			uint64 subsumed, strengthened, learntfly;
 			uint64 subsumedfly, strengthenedfly;
 		} forward;
@@ -120,6 +150,14 @@ namespace SeqFROST {
 	#define ORIGINALLITERALS stats.literals.original
 	#define MAXLITERALS (ORIGINALLITERALS + LEARNTLITERALS)
 
+#ifdef STATISTICS
+	#define ANALYSIS_START(T) const uint64 T = nanotime();
+	#define ANALYSIS_STOP(HIST,T) stats.analysis.HIST.add(nanotime() - T);
+#else
+	#define ANALYSIS_START(T)
+	#define ANALYSIS_STOP(HIST,T)
+#endif
+
 #if defined(__linux__) || defined(__CYGWIN__)
 #pragma GCC diagnostic pop
 #endif
@@ -17,9 +17,21 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 **********************************************************************************/
 
 #include "subsume.hpp" 
+#include "threads.hpp"
 
 using namespace SeqFROST;
 
+// elected variables handed to a thread at once
+constexpr uint32 SUB_CHUNK = 64;
+
+// pairs checked for (self-)subsumption in the lists of 'v'
+inline uint64 subTicks(OT& ot, const uint32& v, const int& maxoccurs)
+{
+	const uint64 ps = ot[V2L(v)].size(), ns = ot[NEG(V2L(v))].size();
+	if (ps > uint64(maxoccurs) || ns > uint64(maxoccurs)) return 1;
+	return 1 + 2 * ps * ns + ((ps * ps + ns * ns) >> 1);
+}
+
 void Solver::SUB()
 {
 	if (opts.sub_en || opts.ve_plus_en) {
@@ -28,20 +40,118 @@ void Solver::SUB()
 		if (opts.profile_simplifier) timer.pstart();
 		const int maxoccurs = opts.sub_max_occurs;
 		const int clausemax = opts.sub_clause_max;
+		// spend the budget in the election order before subsuming
+		SET_BOUNDS(limit, sub, simplify.ticks.sub, searchticks, inf.nLiterals);
+		uint32 nelected = 0;
+		while (nelected < elected.size() && stats.simplify.ticks.sub <= limit)
+			stats.simplify.ticks.sub += subTicks(ot, elected[nelected++], maxoccurs);
+		if (nelected < elected.size())
+			LOG2(2, "  SUB budget exhausted after %d of %d elected variables", nelected, elected.size());
+		// elected variables share no clauses, so workers can 
+		// subsume independently while proof lines and units 
+		// are replayed in the election order afterwards
+		const uint32 nthreads = nThreads(opts.simp_threads, nelected, SUB_CHUNK);
+		Vec<SUBWORKER> workers(nthreads);
+		Vec<WORKSPAN> spans((nelected + SUB_CHUNK - 1) / SUB_CHUNK);
+		CHUNKS chunks(nelected, SUB_CHUNK);
+		runThreads(nthreads, [&](const uint32 tid) {
+			SUBWORKER& worker = workers[tid];
+			uint32 begin, end;
+			while (chunks.pop(begin, end)) {
+				WORKSPAN& span = spans[begin / SUB_CHUNK];
+				span.worker = tid;
+				span.first = worker.log.size();
+				for (uint32 i = begin; i < end; ++i) {
+					const uint32 v = elected[i];
+					CHECKVAR(v);
+					assert(!sp->state[v].state);
+					const uint32 p = V2L(v), n = NEG(p);
+					OL& poss = ot[p], &negs = ot[n];
+					if (poss.size() <= maxoccurs && negs.size() <= maxoccurs)
+						self_sub_x(p, clausemax, scnf, poss, negs, worker);
+				}
+				span.last = worker.log.size();
+			}
+		});
+		forall_vector(WORKSPAN, spans, s) {
+			replaySub(workers[s->worker].log, s->first, s->last);
+		}
+#ifdef STATISTICS
 		SUBSTATS& substats = stats.simplify.sub;
-		forall_vector(uint32, elected, i) {
-			CHECKVAR(*i);
-			assert(!sp->state[*i].state);
-			const uint32 p = V2L(*i), n = NEG(p);
-			OL& poss = ot[p], &negs = ot[n];
-			if (poss.size() <= maxoccurs && negs.size() <= maxoccurs)
-				self_sub_x(p, clausemax, scnf, poss, negs, substats);
+		for (uint32 t = 0; t < nthreads; ++t) {
+			substats.subsumed += workers[t].stats.subsumed;
+			substats.strengthened += workers[t].stats.strengthened;
 		}
+#endif
 		if (opts.profile_simplifier) timer.pstop(), timer.sub += timer.pcpuTime();
 		LOGREDALL(this, 2, "SUB Reductions");
 	}
 }
 
+void Solver::replaySub(uVec1D& log, const uint32& first, const uint32& last)
+{
+	const uint32* record = log + first, *end = log + last;
+	while (record != end) {
+		const uint32 op = *record++;
+		const int size = *record++;
+		if (op == SUB_STRENGTHEN) {
+			// the removed literal leads the strengthened clause
+			assert(size > 1);
+			for (int k = 0; k < size; ++k)
+				ot.touch(record[k]);
+			const uint32* lits = record + 1;
+			if (size == 2) {
+				const uint32 unit = *lits;
+				const LIT_ST val = sp->value[unit];
+				if (UNASSIGNED(val))
+					enqueueUnit(unit);
+				else if (!val) { 
+					LOG2(2, "  Subsume proved a contradiction");
+					learnEmpty();
+					killSolver();
+				}
+			}
+			else if (opts.proof_en)
+				proof.addResolvent(lits, size - 1);
+		}
+		else {
+			assert(op == SUB_DELETE);
+			for (int k = 0; k < size; ++k)
+				ot.touch(record[k]);
+			if (opts.proof_en)
+				proof.deleteClause(record, size);
+		}
+		record += size;
+	}
+}
+
+void Solver::strengthen(SCLAUSE& c, const uint32& me, uVec1D& log)
+{
+	uint32 sig = 0;
+	uint32* j = c;
+	forall_clause(c, k) {
+		const uint32 lit = *k;
+		if (NEQUAL(lit, me)) {
+			*j++ = lit;
+			sig |= MAPHASH(lit);
+		}
+	}
+	assert(c.hasZero() < 0);
+	c.set_sig(sig);
+	c.pop();
+	const int size = c.size();
+	log.push(SUB_STRENGTHEN);
+	log.push(size + 1);
+	log.push(me);
+	for (int k = 0; k < size; ++k)
+		log.push(c[k]);
+	if (size > 1) {
+		assert(c.isSorted());
+		if (c.learnt()) 
+			bumpShrunken(c);
+	}
+}
+
 void Solver::strengthen(SCLAUSE& c, const uint32& me)
 {
 	uint32 sig = 0;
@@ -23,6 +23,26 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 using namespace SeqFROST;
 
+#define SUB_STRENGTHEN 1
+#define SUB_DELETE 2
+
+inline void logSub(uVec1D& log, const uint32& op, const uint32* lits, const int& size)
+{
+	assert(size > 0);
+	log.push(op);
+	log.push(size);
+	for (int k = 0; k < size; ++k)
+		log.push(lits[k]);
+}
+
+inline void removeSubsumed(SCLAUSE& c, uVec1D& log)
+{
+	if (!c.deleted()) {
+		c.markDeleted();
+		logSub(log, SUB_DELETE, c.data(), c.size());
+	}
+}
+
 inline void updateOL(SCNF& scnf, OL& ol)
 {
 	if (ol.empty()) return;
@@ -43,24 +63,7 @@ inline bool sub(SCLAUSE& subsuming, SCLAUSE& subsumed)
 	assert(subsumed.size() > 1);
 	assert(subsuming.size() <= subsumed.size());
 	const int size = subsuming.size();
-	uint32* d1 = subsuming.data(), *d2 = subsumed.data();
-	uint32* e1 = d1 + size;
-	uint32* e2 = subsumed.end();
-	int sub = 0;
-	while (d1 != e1 && d2 != e2) {
-		const uint32 lit1 = *d1, lit2 = *d2;
-		if (lit1 < lit2) 
-			d1++;
-		else if (lit2 < lit1) 
-			d2++;
-		else { 
-			sub++; 
-			d1++, d2++;
-		}
-	}
-	if (sub == size) 
-		return true;
-	return false;
+	return countShared(subsuming.data(), size, subsumed.data(), subsumed.size()) == size;
 }
 
 inline bool sub(Lits_t& subsuming, SCLAUSE& subsumed)
@@ -70,24 +73,7 @@ inline bool sub(Lits_t& subsuming, SCLAUSE& subsumed)
 	assert(subsumed.size() > 1);
 	assert(subsuming.size() <= subsumed.size());
 	const int size = subsuming.size();
-	uint32* d1 = subsuming.data(), *d2 = subsumed.data();
-	uint32* e1 = d1 + size;
-	uint32* e2 = subsumed.end();
-	int sub = 0;
-	while (d1 != e1 && d2 != e2) {
-		const uint32 lit1 = *d1, lit2 = *d2;
-		if (lit1 < lit2) 
-			d1++;
-		else if (lit2 < lit1) 
-			d2++;
-		else { 
-			sub++; 
-			d1++, d2++;
-		}
-	}
-	if (sub == size) 
-		return true;
-	return false;
+	return countShared(subsuming.data(), size, subsumed.data(), subsumed.size()) == size;
 }
 
 inline bool selfsub(const uint32& x, const uint32& fx, SCLAUSE& subsuming, SCLAUSE& subsumed)
@@ -98,45 +84,16 @@ inline bool selfsub(const uint32& x, const uint32& fx, SCLAUSE& subsuming, SCLAU
 	assert(subsumed.size() > 1);
 	assert(subsuming.size() <= subsumed.size());
 	const int size = subsuming.size();
-	uint32* d1 = subsuming.data();
-	uint32* d2 = subsumed.data();
-	uint32* e1 = d1 + size;
-	uint32* e2 = subsumed.end();
-	int sub = 0;
-	bool self = false;
-	while (d1 != e1 && d2 != e2) {
-		const uint32 lit1 = *d1;
-		const uint32 lit2 = *d2;
-		if (lit1 == fx) 
-			d1++;
-		else if (lit2 == x) { 
-			self = true; 
-			d2++; 
-		}
-		else if (lit1 < lit2)
-			d1++;
-		else if (lit2 < lit1)
-			d2++;
-		else { 
-			sub++; 
-			d1++, d2++; 
-		}
-	}
-	if ((sub + 1) == size) {
-		if (self) 
-			return true;
-		else {
-			while (d2 != e2) {
-				if (*d2 == x) 
-					return true;
-				d2++;
-			}
-		}
+	// 'fx' of 'subsuming' is never shared with 'subsumed' having 'x'
+	if (countShared(subsuming.data(), size, subsumed.data(), subsumed.size()) + 1 != size) 
+		return false;
+	forall_clause(subsumed, k) {
+		if (*k == x) return true;
 	}
 	return false;
 }
 
-inline bool subsume(SCNF& scnf, OL& list, S_REF* end, SCLAUSE& cand)
+inline bool subsume(SCNF& scnf, OL& list, S_REF* end, SCLAUSE& cand, uVec1D& log)
 {
 	const int candsz = cand.size();
 	for (S_REF* j = list; j != end; ++j) {
@@ -146,7 +103,7 @@ inline bool subsume(SCNF& scnf, OL& list, S_REF* end, SCLAUSE& cand)
 		if (subsuming.size() > 1 && sub(subsuming.sig(), cand.sig()) && sub(subsuming, cand)) {
 			if (subsuming.learnt() && cand.original()) 
 				subsuming.set_status(ORIGINAL);
-			solver->removeClause(cand);
+			removeSubsumed(cand, log);
 			LOGCLAUSE(4, cand, " Clause ");
 			LOGCLAUSE(4, subsuming, " Subsumed by ");
 			return true;
@@ -155,7 +112,7 @@ inline bool subsume(SCNF& scnf, OL& list, S_REF* end, SCLAUSE& cand)
 	return false;
 }
 
-inline bool selfsubsume(const uint32& x, const uint32& fx, SCNF& scnf, OL& list, SCLAUSE& cand)
+inline bool selfsubsume(const uint32& x, const uint32& fx, SCNF& scnf, OL& list, SCLAUSE& cand, uVec1D& log)
 {
 	// try to strengthen 'cand' by removing 'x'
 	const int candsz = cand.size();
@@ -167,7 +124,7 @@ inline bool selfsubsume(const uint32& x, const uint32& fx, SCNF& scnf, OL& list,
 		if (subsuming.deleted()) continue;
 		if (subsize > 1 && selfsub(subsuming.sig(), candsig) && selfsub(x, fx, subsuming, cand)) {
 			LOGCLAUSE(4, cand, " Clause ");
-			solver->strengthen(cand, x);
+			solver->strengthen(cand, x, log);
 			cand.melt(); // mark for fast recongnition in ot update 
 			LOGCLAUSE(4, subsuming, " Strengthened by ");
 			return true; // cannot strengthen "cand" anymore, 'x' already removed
@@ -176,7 +133,8 @@ inline bool selfsubsume(const uint32& x, const uint32& fx, SCNF& scnf, OL& list,
 	return false;
 }
 
-inline void self_sub_x(const uint32& p, const int& maxClauseSize, SCNF& scnf, OL& poss, OL& negs, SUBSTATS& substats)
+// touches only the clauses of 'p' and records their changes in 'worker'
+inline void self_sub_x(const uint32& p, const int& maxClauseSize, SCNF& scnf, OL& poss, OL& negs, SUBWORKER& worker)
 {
 	CHECKLIT(p);
 	assert(checkMolten(scnf, poss, negs));
@@ -188,11 +146,11 @@ inline void self_sub_x(const uint32& p, const int& maxClauseSize, SCNF& scnf, OL
 		if (pos.size() > maxClauseSize) break;
 		if (pos.deleted()) continue;
 #ifdef STATISTICS
-		if (selfsubsume(p, n, scnf, negs, pos)) substats.strengthened++;
-		if (subsume(scnf, poss, i, pos)) substats.subsumed++;
+		if (selfsubsume(p, n, scnf, negs, pos, worker.log)) worker.stats.strengthened++;
+		if (subsume(scnf, poss, i, pos, worker.log)) worker.stats.subsumed++;
 #else 
-		selfsubsume(p, n, scnf, negs, pos);
-		subsume(scnf, poss, i, pos);
+		selfsubsume(p, n, scnf, negs, pos, worker.log);
+		subsume(scnf, poss, i, pos, worker.log);
 #endif
 	}
 
@@ -204,11 +162,11 @@ inline void self_sub_x(const uint32& p, const int& maxClauseSize, SCNF& scnf, OL
 		if (neg.size() > maxClauseSize) break;
 		if (neg.deleted()) continue;
 #ifdef STATISTICS
-		if (selfsubsume(n, p, scnf, poss, neg)) substats.strengthened++;
-		if (subsume(scnf, negs, i, neg)) substats.subsumed++;
+		if (selfsubsume(n, p, scnf, poss, neg, worker.log)) worker.stats.strengthened++;
+		if (subsume(scnf, negs, i, neg, worker.log)) worker.stats.subsumed++;
 #else
-		selfsubsume(n, p, scnf, poss, neg);
-		subsume(scnf, negs, i, neg);
+		selfsubsume(n, p, scnf, poss, neg, worker.log);
+		subsume(scnf, negs, i, neg, worker.log);
 #endif
 	}
 
@@ -32,78 +32,52 @@ inline bool SCORS_CMP::operator () (const uint32& a, const uint32& b) const
     return a > b;
 }
 
-inline bool Solver::findBinary(uint32 first, uint32 second, const cbucket_t* cs) 
+inline bool Solver::findBinary(const uint32& first, const uint32& second, const cbucket_t* cs) 
 {
-    assert(wot.size());
     assert(active(first));
     assert(active(second));
     CHECKLIT(first);
     CHECKLIT(second);
 
-    if (wot[first].size() > wot[second].size()) std::swap(first, second);
+    stats.ternary.checks++;
 
-    WOL& list = wot[first];
+    const uint32 lits[2] = { first, second };
+    const C_REF ref = thash.find(fingerprint(lits, 2), [&](const C_REF& r) {
+        GET_CLAUSE(c, r, cs);
+        if (!c.binary() || cm.deleted(r)) return false;
+        const uint32 x = c[0], y = c[1];
+        return (x == first && y == second) || (x == second && y == first);
+    });
 
-    stats.ternary.checks += CACHELINES(list.size()) + 1;
-
-    forall_wol(list, i) {
-        GET_CLAUSE(c, *i, cs);
-        if (c.binary()) {
-            const uint32* lits = c.data();
-            const uint32 other = lits[0] ^ lits[1] ^ first;
-            if (other == second) return true;
-        }
-    }
-
-    return false;
+    return ref != UNDEF_REF;
 }
 
-inline bool Solver::findTernary(uint32 first, uint32 second, uint32 third, const cbucket_t* cs)
+inline bool Solver::findTernary(const uint32& first, const uint32& second, const uint32& third, const cbucket_t* cs)
 {
-    assert(wot.size());
     assert(active(first));
     assert(active(second));
     CHECKLIT(first);
     CHECKLIT(second);
     CHECKLIT(third);
 
-    if (wot[second].size() > wot[third].size()) std::swap(second, third);
-    if (wot[first].size() > wot[second].size()) std::swap(first, second);
-
-    WOL& list = wot[first];
+    stats.ternary.checks++;
 
-    stats.ternary.checks += CACHELINES(list.size()) + 1;
+    const uint32 lits[3] = { first, second, third };
+    const C_REF ref = thash.find(fingerprint(lits, 3), [&](const C_REF& r) {
+        GET_CLAUSE(c, r, cs);
+        if (c.size() != 3 || cm.deleted(r)) return false;
+        // clauses have no repeated literals
+        const uint32 x = c[0], y = c[1], z = c[2];
+        return (x == first || y == first || z == first)
+            && (x == second || y == second || z == second)
+            && (x == third || y == third || z == third);
+    });
 
-    forall_wol(list, i) {
-        GET_CLAUSE(c, *i, cs);
-        const uint32* lits = c.data();
-        if (c.binary()) {
-            const uint32 other = lits[0] ^ lits[1] ^ first;
-            assert(other != first);
-            CHECKLIT(other);
-            if (other == second) return true;
-            if (other == third) return true;
-        }
-        else {
-            assert(c.size() == 3);
-            stats.ternary.checks++;
-            const uint32 x = lits[0], y = lits[1], z = lits[2];
-            if (x == first) {
-                if (y == second && z == third) return true;
-                if (z == second && y == third) return true;
-            }
-            else if (y == first) {
-                if (x == second && z == third) return true;
-                if (z == second && x == third) return true;
-            }
-            else if (z == first) {
-                if (x == second && y == third) return true;
-                if (y == second && x == third) return true;
-            }
-        }
-    }
+    if (ref != UNDEF_REF) return true;
 
-    return findBinary(second, third, cs);
+    return findBinary(first, second, cs) 
+        || findBinary(first, third, cs) 
+        || findBinary(second, third, cs);
 }
 
 bool Solver::hyper3Resolve(CLAUSE& pos, CLAUSE& neg, const uint32& p)
@@ -197,7 +171,7 @@ void Solver::ternaryResolve(const uint32& p, const uint64& limit)
                     stats.ternary.binaries++;
                 }
 
-                newHyper3(learnt);
+                thash.insert(fingerprint(learntC, size), newHyper3(learnt));
 
                 pos = cm.clause(pref); // update if cm memory is reallocated
             }
@@ -234,15 +208,17 @@ void Solver::attachTernary(BCNF& cnf, LIT_ST* use, const cbucket_t* cs, const bo
             const uint32* lits = c.data();
             const uint32 x = lits[0];
             const uint32 y = lits[1];
-            const uint32 z = lits[2];
             if (UNASSIGNED(values[x]) &&
                 UNASSIGNED(values[y])) {
                 if (size == 2) {
                     ATTACH_BINARY(ref, x, y);
+                    thash.insert(fingerprint(lits, 2), ref);
                 }
-                else if (UNASSIGNED(values[z])) {
-                    assert(size > 1);
+                else if (UNASSIGNED(values[lits[2]])) {
+                    assert(size == 3);
+                    const uint32 z = lits[2];
                     ATTACH_TERNARY(ref, x, y, z);
+                    thash.insert(fingerprint(lits, 3), ref);
                     use[x] = use[y] = use[z] = 1;
                 }
             }
@@ -292,6 +268,7 @@ void Solver::ternary()
     }
     std::free(use);
     wot.clear(true);
+    thash.clear(true);
     vschedule.destroy();
     rebuildWT(opts.ternary_priorbins);
     if (retrail()) LOG2(2, " Propagation after ternary proved a contradiction");
@@ -0,0 +1,76 @@
+/***********************************************************************[threads.hpp]
+Copyright(c) 2022, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __THREADS_
+#define __THREADS_
+
+#include <thread>
+#include <atomic>
+#include "constants.hpp"
+
+namespace SeqFROST {
+
+	/*****************************************************/
+	/*  Usage:   fork-join helpers for simplifications   */
+	/*  Dependency:  std::thread, std::atomic            */
+	/*****************************************************/
+
+	// '0' requests all hardware threads, capped by the chunks of work
+	inline uint32 nThreads(const uint32& requested, const uint32& size, const uint32& chunk) {
+		uint32 nthreads = requested;
+		if (!nthreads) nthreads = std::thread::hardware_concurrency();
+		const uint32 nchunks = (size + chunk - 1) / chunk;
+		nthreads = MIN(nthreads, nchunks);
+		return MAX(nthreads, 1);
+	}
+
+	// run 'job(tid)' on 'nthreads' threads, the caller being 'tid = 0'
+	template <class JOB>
+	inline void runThreads(const uint32& nthreads, JOB job) {
+		if (nthreads <= 1) { job(0); return; }
+		std::thread* workers = new std::thread[nthreads - 1];
+		for (uint32 t = 1; t < nthreads; ++t)
+			workers[t - 1] = std::thread(job, t);
+		job(0);
+		for (uint32 t = 1; t < nthreads; ++t)
+			workers[t - 1].join();
+		delete[] workers;
+	}
+
+	// hands out chunks of [0, size) to threads on demand
+	class CHUNKS {
+
+		std::atomic<uint32> _next;
+		const uint32 _size, _chunk;
+
+	public:
+		CHUNKS(const uint32& size, const uint32& chunk) : 
+			_next(0), _size(size), _chunk(chunk ? chunk : 1) {}
+
+		inline bool pop(uint32& begin, uint32& end) {
+			begin = _next.fetch_add(_chunk, std::memory_order_relaxed);
+			if (begin >= _size) return false;
+			end = begin + _chunk;
+			if (end > _size) end = _size;
+			return true;
+		}
+	};
+
+}
+
+#endif
@@ -40,7 +40,7 @@ namespace SeqFROST {
 
 	public:
 		double parse, solve, simplify;
-		double vo, ve, sub, bce, ere, cot, rot, sot, gc, io;
+		double vo, ve, sub, bce, ere, bva, amo, cot, rot, sot, gc, io;
 				TIMER		() { RESETSTRUCT(this); }
 		void	start		() { _start = high_resolution_clock::now(); }
 		void	stop		() { _stop = high_resolution_clock::now();}
@@ -50,6 +50,9 @@ namespace SeqFROST {
 		double	pcpuTime	() { return _cpuTime = duration_cast<duration<double>>(_stopp - _startp).count() * 1000.0; }
 	};
 
+	// monotonic time stamp in nanoseconds for fine-grained latencies
+	inline uint64 nanotime() { return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count(); }
+
 #if defined(__linux__) || defined(__CYGWIN__)
 #pragma GCC diagnostic pop
 #endif
@@ -96,7 +96,7 @@ inline void	Solver::analyzeLit(const uint32& lit, int& track, int& size)
 inline bool Solver::analyzeReason(const C_REF& ref, const uint32& parent, int& track) 
 {
 	CHECKLIT(parent);
-	CLAUSE& reason = cm[ref];
+	CLAUSE& reason = explain(ref, parent);
 	LOGCLAUSE(4, reason, "  analyzing %d reason", l2i(parent));
 	sp->reasonsize = 1;
 	sp->conflictdepth++;
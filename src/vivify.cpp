@@ -117,7 +117,7 @@ bool Solver::vivifyAnalyze(CLAUSE& cand, bool& original)
 		assert(seen[v]);
 		const C_REF src = sources[v];
 		if (REASON(src)) {
-			CLAUSE& reason = cm[src];
+			CLAUSE& reason = explain(src, lit);
 			LOGCLAUSE(4, reason, "  analyzing %d reason", l2i(lit));
 			if (reason.learnt()) conflictoriginality = false;
 			if (reason.binary()) {
@@ -481,7 +481,10 @@ void Solver::vivifying(const CL_ST& type)
 	}
 	vhist.clear(true);
 	schedule.clear(true);
-	if (NOT_UNSAT) backtrack();
+	if (NOT_UNSAT) {
+		backtrack();
+		conflict = UNDEF_REF; // last candidate conflict is no longer needed
+	}
 	stats.vivify.vivified += vivified;
 	LOG2(2, " Vivification %lld: vivified %d %s clauses %.2f%% per %d candidates",
 		stats.probe.calls, vivified, 